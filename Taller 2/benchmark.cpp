@@ -0,0 +1,281 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <pthread.h>
+#include "maze.h"
+#include "solver.h"
+
+// Benchmark de Taller 2: genera laberintos de distintos tamaños, los resuelve con
+// solveMaze y registra tiempos, memoria pico, celdas expandidas y largo del camino.
+// Cada laberinto se genera con una semilla fija (su tamaño), así los resultados se pueden comparar entre corridas.
+//
+// Uso: ./benchmark [--max N] [--format csv|json] [--out archivo]
+
+// Resultado de una medición para un tamaño de laberinto
+struct BenchResult {
+    int rows, cols;
+    double generationMs = 0;
+    double solveMs = 0;
+    long generationPeakKb = 0;
+    long solvePeakKb = 0;
+    long long cellsExpanded = 0;
+    long long pathLength = 0;
+    bool solved = false;
+    std::string status = "ok";
+};
+
+// Argumentos para ejecutar solveMaze en un hilo con pila propia
+struct SolveTask {
+    Maze* maze;
+    bool solved;
+};
+
+// Bytes de pila por nivel de recursión de solveMaze. Se mide al inicio con calibrateFrameBytes
+size_t frameBytes = 0;
+
+// Tamaño del laberinto con el que se mide frameBytes y pila con la que se resuelve
+const int kCalibrationSize = 501;
+const size_t kCalibrationStack = 64 << 20;
+
+// Patrón con el que se llena la pila de calibración para ver hasta dónde llegó solveMaze
+const unsigned char kStackPattern = 0xA5;
+
+// Reinicia el pico de memoria residente (VmHWM) del proceso. Solo disponible en Linux.
+void resetPeakMemory() {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs) {
+        clearRefs << "5";
+    }
+}
+
+// Lee el pico de memoria residente (VmHWM) del proceso en KB, o -1 si no está disponible
+long readPeakMemoryKb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::stol(line.substr(6));
+        }
+    }
+    return -1;
+}
+
+void* solveThread(void* arg) {
+    SolveTask* task = static_cast<SolveTask*>(arg);
+    task->solved = solveMaze(*task->maze, task->maze->getEntry());
+    return nullptr;
+}
+
+// Ejecuta solveMaze en un hilo con "attr" y espera a que termine. Devuelve false si no se pudo crear el hilo
+bool runSolveThread(Maze& maze, pthread_attr_t& attr, bool& solved) {
+    SolveTask task{&maze, false};
+    pthread_t thread;
+    if (pthread_create(&thread, &attr, solveThread, &task) != 0) {
+        return false;
+    }
+    pthread_join(thread, nullptr);
+    solved = task.solved;
+    return true;
+}
+
+// solveMaze es recursivo, por lo que se ejecuta en un hilo con una pila dimensionada para el laberinto
+bool runSolve(Maze& maze, size_t stackSize, bool& solved) {
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    bool ok = pthread_attr_setstacksize(&attr, stackSize) == 0 && runSolveThread(maze, attr, solved);
+    pthread_attr_destroy(&attr);
+    return ok;
+}
+
+// Distancia (BFS) desde la entrada hasta la celda más lejana de las que cumplen "include". Recorre por niveles y
+// solo guarda un bit por celda, para que alcance con laberintos de 20001x20001
+template<class Include>
+long long deepestLevel(Maze& maze, Include include) {
+    std::vector<std::vector<bool>> seen(maze.getRows(), std::vector<bool>(maze.getCols(), false));
+    Maze::Point entry = maze.getEntry();
+    seen[entry.x][entry.y] = true;
+    std::vector<Maze::Point> level{entry};
+    std::vector<Maze::Point> next;
+    long long depth = 0;
+    while (true) {
+        next.clear();
+        for (Maze::Point pt : level) {
+            for (Maze::Point neighbor : maze.getNeighbors(pt)) {
+                if (maze.isInside(neighbor) && !seen[neighbor.x][neighbor.y] && include(neighbor)) {
+                    seen[neighbor.x][neighbor.y] = true;
+                    next.push_back(neighbor);
+                }
+            }
+        }
+        if (next.empty()) {
+            return depth;
+        }
+        level.swap(next);
+        depth++;
+    }
+}
+
+// Profundidad máxima de recursión que alcanzó solveMaze. El laberinto es perfecto (un árbol), así que el camino
+// desde la entrada hasta cada celda visitada es único y la profundidad de esa celda es su distancia (BFS) a la
+// entrada. Se suma la llamada de la entrada y la que encuentra una pared o una celda ya visitada
+long long maxSolveDepth(Maze& maze) {
+    return deepestLevel(maze, [&](Maze::Point pt) { return maze.isVisited(pt); }) + 2;
+}
+
+// Cota de la profundidad de recursión antes de resolver: solveMaze nunca llega más lejos que la celda abierta más
+// distante de la entrada. Es mucho menor que la mitad de las celdas (menos del 7% en estos laberintos)
+long long solveDepthBound(Maze& maze) {
+    return deepestLevel(maze, [&](Maze::Point pt) { return !maze.isWall(pt); }) + 2;
+}
+
+// Mide los bytes de pila por nivel de recursión: resuelve un laberinto de kCalibrationSize en una pila propia
+// llena con kStackPattern, cuenta cuántos bytes cambiaron y los divide por la profundidad máxima alcanzada.
+// Se agrega un 25% de margen. Devuelve 0 si no se pudo medir
+size_t calibrateFrameBytes() {
+    void* stack = nullptr;
+    if (posix_memalign(&stack, 4096, kCalibrationStack) != 0) {
+        return 0;
+    }
+    std::memset(stack, kStackPattern, kCalibrationStack);
+
+    Maze maze(kCalibrationSize, kCalibrationSize, kCalibrationSize);
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    bool solved = false;
+    bool ok = pthread_attr_setstack(&attr, stack, kCalibrationStack) == 0 && runSolveThread(maze, attr, solved);
+    pthread_attr_destroy(&attr);
+
+    size_t untouched = 0;
+    const unsigned char* bytes = static_cast<const unsigned char*>(stack);
+    while (untouched < kCalibrationStack && bytes[untouched] == kStackPattern) {
+        untouched++;
+    }
+    free(stack);
+    if (!ok || untouched == 0) {
+        return 0;   // No se pudo crear el hilo o se usó toda la pila (la medición no sirve)
+    }
+    size_t used = kCalibrationStack - untouched;
+    return used / static_cast<size_t>(maxSolveDepth(maze)) * 5 / 4 + 1;
+}
+
+BenchResult benchmarkSize(int n) {
+    using clock = std::chrono::steady_clock;
+    BenchResult result;
+    result.rows = n;
+    result.cols = n;
+
+    try {
+        resetPeakMemory();
+        auto startGeneration = clock::now();
+        Maze maze(n, n, static_cast<unsigned int>(n));
+        auto endGeneration = clock::now();
+        result.generationMs = std::chrono::duration<double, std::milli>(endGeneration - startGeneration).count();
+        result.generationPeakKb = readPeakMemoryKb();
+
+        // Pila para la recursión más profunda posible, con el tamaño de marco medido al inicio
+        size_t stackSize = std::max<size_t>(static_cast<size_t>(solveDepthBound(maze)) * frameBytes, 8 << 20);
+
+        resetPeakMemory();
+        auto startSolve = clock::now();
+        bool solved = false;
+        if (!runSolve(maze, stackSize, solved)) {
+            result.status = "omitido: no se pudo reservar una pila de " + std::to_string(stackSize >> 20) + " MB";
+            return result;
+        }
+        auto endSolve = clock::now();
+        result.solveMs = std::chrono::duration<double, std::milli>(endSolve - startSolve).count();
+        result.solvePeakKb = readPeakMemoryKb();
+        result.solved = solved;
+        result.cellsExpanded = maze.getVisitedCount();
+        result.pathLength = maze.getPathLength();
+    } catch (const std::bad_alloc&) {
+        result.status = "omitido: sin memoria";
+    }
+    return result;
+}
+
+void writeCsv(std::ostream& out, const std::vector<BenchResult>& results) {
+    out << "rows,cols,generation_ms,solve_ms,generation_peak_kb,solve_peak_kb,cells_expanded,path_length,solved,status\n";
+    for (const auto& r : results) {
+        out << r.rows << ',' << r.cols << ',' << r.generationMs << ',' << r.solveMs << ','
+            << r.generationPeakKb << ',' << r.solvePeakKb << ',' << r.cellsExpanded << ','
+            << r.pathLength << ',' << (r.solved ? "true" : "false") << ",\"" << r.status << "\"\n";
+    }
+}
+
+void writeJson(std::ostream& out, const std::vector<BenchResult>& results) {
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        out << "  {\"rows\": " << r.rows << ", \"cols\": " << r.cols
+            << ", \"generation_ms\": " << r.generationMs << ", \"solve_ms\": " << r.solveMs
+            << ", \"generation_peak_kb\": " << r.generationPeakKb << ", \"solve_peak_kb\": " << r.solvePeakKb
+            << ", \"cells_expanded\": " << r.cellsExpanded << ", \"path_length\": " << r.pathLength
+            << ", \"solved\": " << (r.solved ? "true" : "false") << ", \"status\": \"" << r.status << "\"}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+int main(int argc, char* argv[]) {
+    int maxSize = 20001;
+    std::string format = "csv";
+    std::string outPath;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--max" && i + 1 < argc) {
+            maxSize = std::stoi(argv[++i]);
+        } else if (arg == "--format" && i + 1 < argc) {
+            format = argv[++i];
+        } else if (arg == "--out" && i + 1 < argc) {
+            outPath = argv[++i];
+        } else {
+            std::cerr << "Uso: " << argv[0] << " [--max N] [--format csv|json] [--out archivo]" << std::endl;
+            return 1;
+        }
+    }
+
+    // Tamaños impares (el generador solo funciona con dimensiones impares)
+    const std::vector<int> sizes = {11, 21, 51, 101, 201, 501, 1001, 2001, 5001, 10001, 20001};
+
+    frameBytes = calibrateFrameBytes();
+    if (frameBytes == 0) {
+        std::cerr << "No se pudo medir la pila que usa solveMaze" << std::endl;
+        return 1;
+    }
+    std::cerr << "solveMaze usa unos " << frameBytes << " bytes de pila por nivel" << std::endl;
+
+    std::vector<BenchResult> results;
+    for (int n : sizes) {
+        if (n > maxSize) {
+            break;
+        }
+        std::cerr << "Midiendo " << n << "x" << n << "..." << std::endl;
+        results.push_back(benchmarkSize(n));
+    }
+
+    std::ofstream file;
+    if (!outPath.empty()) {
+        file.open(outPath);
+        if (!file) {
+            std::cerr << "No se pudo abrir " << outPath << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = outPath.empty() ? std::cout : file;
+
+    if (format == "json") {
+        writeJson(out, results);
+    } else {
+        writeCsv(out, results);
+    }
+
+    return 0;
+}
@@ -20,6 +20,8 @@ private:
     std::vector<std::vector<int>> grid;
     std::vector<std::vector<bool>> visited;
     int rows, cols;
+    long long visitedCount = 0;  // Celdas expandidas por el solucionador
+    long long pathLength = 0;    // Celdas marcadas como parte de la solucion
     std::vector<std::pair<int, int>> directions = {{0, 2}, {2, 0}, {0, -2}, {-2, 0}};  // Direcciones para moverse
 
     
@@ -34,14 +36,20 @@ public:
 
     void markVisited(Point pt) {
         visited[pt.x][pt.y] = true;
+        visitedCount++;
     }
 
     void markPath(Point pt) {
         grid[pt.x][pt.y] = 2;
+        pathLength++;
     }
 
-     Maze(int r, int c) : rows(r), cols(c) {
+     Maze(int r, int c) : Maze(r, c, std::random_device{}()) {
         srand(time(0));
+    }
+
+    // Genera el laberinto con una semilla fija: la misma semilla y el mismo tamaño dan siempre el mismo laberinto
+    Maze(int r, int c, unsigned int seed) : rows(r), cols(c) {
 
         // Inicializar el laberinto con todas las paredes
         grid = std::vector<std::vector<int>>(rows, std::vector<int>(cols, 1));
@@ -52,8 +60,7 @@ public:
         s.push({1, 1});
         grid[1][1] = 0;
 
-        std::random_device rd;
-        std::mt19937 g(rd());
+        std::mt19937 g(seed);
 
         while (!s.empty()) {
             int x = s.top().first;
@@ -111,6 +118,22 @@ public:
         }
     }
 
+    int getRows() const {
+        return rows;
+    }
+
+    int getCols() const {
+        return cols;
+    }
+
+    long long getVisitedCount() const {
+        return visitedCount;
+    }
+
+    long long getPathLength() const {
+        return pathLength;
+    }
+
     Point getEntry() {
         return Point(0, 1);
     }
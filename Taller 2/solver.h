@@ -0,0 +1,42 @@
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "maze.h"
+
+/**
+ * Solves a given maze by recursively exploring neighboring points.
+ *
+ * @param maze The maze to be solved.
+ * @param pt The current point in the maze.
+ *
+ * @return True if the maze has been solved, false otherwise.
+ */
+inline bool solveMaze(Maze& maze, Maze::Point pt) {
+    // Caso base
+    if (pt.x == maze.getExit().x && pt.y == maze.getExit().y) {
+        return true;
+    }
+
+    // Caso base
+    if (!maze.isValid(pt.x, pt.y) || maze.isWall(pt) || maze.isVisited(pt)) {
+        return false;
+    }
+
+    // Caso recursivo
+
+    // Marcar punto como visitado
+    maze.markVisited(pt);
+
+    // Explorar vecinos
+    for (auto p: maze.getNeighbors(pt)) {
+        if (solveMaze(maze, p)) {
+            maze.markPath(pt);
+            return true;
+        }
+    }
+
+    // No hay solucion
+    return false;
+}
+
+#endif //SOLVER_H
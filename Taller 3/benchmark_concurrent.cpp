@@ -0,0 +1,206 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include "toy_shelf.h"
+#include "concurrent_toy_shelf.h"
+
+// Mide el rendimiento (operaciones por segundo) de ConcurrentToyShelf con varios hilos y lo compara con un ToyShelf
+// protegido por un único mutex. Cada hilo hace --ops operaciones: casi todas son move_below entre juguetes al azar y
+// una fracción (--add-ratio) son add_toy con IDs nuevos.
+//
+// El ToyShelf de referencia usa add_toy y move_below de a una operación, con set_verbose(false) para no imprimir.
+// Con un solo núcleo (hardware_concurrency = 1) los hilos se turnan y no hay aceleración que medir: la tabla solo
+// muestra el costo de los bloqueos; para ver la escalabilidad hay que correrlo en una máquina con varios núcleos.
+//
+// Al final corre una prueba de estrés: en cada intento dos hilos hacen move_below(a, b) y move_below(b, a) a la vez
+// sobre una estantería nueva, y las posiciones de a y b tienen que coincidir con alguno de los dos órdenes en serie
+// (calculados con ToyShelf).
+//
+// Uso: ./benchmark_concurrent [--toys N] [--capacity C] [--ops M] [--max-threads T] [--add-ratio P] [--stress-trials K]
+
+struct Operation {
+    bool add;
+    int x;
+    int y;
+};
+
+static std::vector<std::vector<Operation>> make_workload(int threads, int ops, int toy_count, double add_ratio) {
+    std::vector<std::vector<Operation>> work(threads);
+    for (int t = 0; t < threads; t++) {
+        std::mt19937 rng(1000 + t);
+        std::uniform_int_distribution<int> pick_toy(0, toy_count - 1);
+        std::bernoulli_distribution pick_add(add_ratio);
+        int next_id = toy_count + t * ops;   // Cada hilo agrega IDs de un rango propio
+        work[t].reserve(ops);
+        for (int i = 0; i < ops; i++) {
+            if (pick_add(rng)) {
+                work[t].push_back({true, next_id++, 0});
+            } else {
+                work[t].push_back({false, pick_toy(rng), pick_toy(rng)});
+            }
+        }
+    }
+    return work;
+}
+
+template<class Worker>
+static double run_threads(int threads, Worker worker) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back(worker, t);
+    }
+    for (auto &thread : pool) {
+        thread.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Posiciones {estantería, casilla} de a y b
+using PairLocation = std::pair<std::pair<int, int>, std::pair<int, int>>;
+
+// Resultado en serie de move_below(first.x, first.y) y luego move_below(second.x, second.y), con ToyShelf
+static PairLocation serial_moves(int capacity, int toys, std::pair<int, int> first, std::pair<int, int> second,
+                                 int a, int b) {
+    ToyShelf shelf(capacity);
+    shelf.set_verbose(false);
+    for (int id = 0; id < toys; id++) {
+        shelf.add_toy(id, "Toy");
+    }
+    shelf.move_below(first.first, first.second);
+    shelf.move_below(second.first, second.second);
+    SlotLocation la = shelf.locate(a);
+    SlotLocation lb = shelf.locate(b);
+    return {{la.stand, la.slot}, {lb.stand, lb.slot}};
+}
+
+// Corre "trials" veces move_below(a, b) y move_below(b, a) en paralelo y devuelve cuántas veces el resultado no
+// coincide con ninguno de los dos órdenes en serie. a queda en la casilla 0 y b cinco estanterías más abajo
+static int stress_opposite_moves(int trials) {
+    const int capacity = 10;
+    const int toys = 6 * capacity;
+    const int a = toys - 1;
+    const int b = a - 5 * capacity;
+    PairLocation a_first = serial_moves(capacity, toys, {a, b}, {b, a}, a, b);
+    PairLocation b_first = serial_moves(capacity, toys, {b, a}, {a, b}, a, b);
+
+    int mismatches = 0;
+    for (int trial = 0; trial < trials; trial++) {
+        ConcurrentToyShelf shelf(capacity);
+        for (int id = 0; id < toys; id++) {
+            shelf.add_toy(id, "Toy");
+        }
+        std::atomic<int> ready{0};
+        run_threads(2, [&](int t) {
+            ready++;
+            while (ready.load() < 2) {
+                std::this_thread::yield();
+            }
+            if (t == 0) {
+                shelf.move_below(a, b);
+            } else {
+                shelf.move_below(b, a);
+            }
+        });
+        PairLocation result = {shelf.locate(a), shelf.locate(b)};
+        if (result != a_first && result != b_first) {
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+int main(int argc, char *argv[]) {
+    int toy_count = 100000;
+    int capacity = 10;
+    int ops = 200000;
+    int max_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    double add_ratio = 0.01;
+    int stress_trials = 2000;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--toys") {
+            toy_count = std::stoi(argv[++i]);
+        } else if (arg == "--capacity") {
+            capacity = std::stoi(argv[++i]);
+        } else if (arg == "--ops") {
+            ops = std::stoi(argv[++i]);
+        } else if (arg == "--max-threads") {
+            max_threads = std::stoi(argv[++i]);
+        } else if (arg == "--add-ratio") {
+            add_ratio = std::stod(argv[++i]);
+        } else if (arg == "--stress-trials") {
+            stress_trials = std::stoi(argv[++i]);
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<Toy> catalog;
+    for (int i = 0; i < toy_count; i++) {
+        catalog.emplace_back(i, "Toy" + std::to_string(i % 100));
+    }
+
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(18) << "mutex ops/s"
+              << std::setw(18) << "sharded ops/s" << std::setw(10) << "speedup" << std::endl;
+
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        auto work = make_workload(threads, ops, toy_count, add_ratio);
+        double total_ops = static_cast<double>(threads) * ops;
+
+        ToyShelf locked_shelf(capacity, catalog);
+        locked_shelf.set_verbose(false);
+        std::mutex shelf_mutex;
+        double mutex_seconds = run_threads(threads, [&](int t) {
+            for (const Operation &op : work[t]) {
+                std::lock_guard<std::mutex> guard(shelf_mutex);
+                if (op.add) {
+                    locked_shelf.add_toy(op.x, "New");
+                } else {
+                    locked_shelf.move_below(op.x, op.y);
+                }
+            }
+        });
+
+        ConcurrentToyShelf sharded_shelf(capacity);
+        for (const Toy &toy : catalog) {
+            sharded_shelf.add_toy(toy.id, toy.name);
+        }
+        double sharded_seconds = run_threads(threads, [&](int t) {
+            for (const Operation &op : work[t]) {
+                if (op.add) {
+                    sharded_shelf.add_toy(op.x, "New");
+                } else {
+                    sharded_shelf.move_below(op.x, op.y);
+                }
+            }
+        });
+
+        std::cout << std::setw(8) << threads
+                  << std::setw(18) << static_cast<long long>(total_ops / mutex_seconds)
+                  << std::setw(18) << static_cast<long long>(total_ops / sharded_seconds)
+                  << std::setw(10) << std::fixed << std::setprecision(2) << mutex_seconds / sharded_seconds
+                  << std::defaultfloat << std::endl;
+    }
+
+    int mismatches = stress_opposite_moves(stress_trials);
+    std::cout << std::endl << "Opposite move_below stress: " << stress_trials << " trials, " << mismatches
+              << " results that match no serial order" << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include "toy_shelf.h"
+
+// Compara el arranque de una estantería reconstruyéndola (bulk_load + todos los movimientos) con cargar un snapshot
+// guardado con ToyShelf::save. Como referencia también mide cuánto tarda solo leer el archivo completo.
+// Al final guarda una estantería pequeña, la daña de varias formas (cabecera, secciones, archivo truncado) y verifica
+// que ToyShelf::load rechace cada copia con una excepción.
+//
+// Uso: ./benchmark_snapshot [--toys N] [--capacity C] [--moves M] [--file ruta]
+
+static double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::vector<char> read_file(const std::string &path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    std::vector<char> raw(static_cast<size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(raw.data(), static_cast<std::streamsize>(raw.size()));
+    return raw;
+}
+
+template<class T>
+static void write_field(std::vector<char> &raw, size_t offset, T value) {
+    std::memcpy(raw.data() + offset, &value, sizeof(value));
+}
+
+template<class T>
+static T read_field(const std::vector<char> &raw, size_t offset) {
+    T value;
+    std::memcpy(&value, raw.data() + offset, sizeof(value));
+    return value;
+}
+
+// Daña copias del snapshot de una estantería pequeña y cuenta cuántas rechaza load. Los desplazamientos siguen el
+// formato de ToyShelf::save: cabecera de 72 bytes, secciones alineadas a 8 bytes (las casillas empiezan en 72) y
+// casillas de 12 bytes en la tabla del índice (ID, posición, handle del nombre)
+static int check_corrupt_snapshots(const std::string &path, int &total) {
+    std::vector<Toy> catalog;
+    for (int i = 0; i < 25; i++) {
+        catalog.emplace_back(i, "Toy" + std::to_string(i % 7));
+    }
+    ToyShelf shelf(10, catalog);
+    shelf.apply_moves(std::vector<std::pair<int, int>>{{3, 20}, {7, 3}, {0, 12}});
+    shelf.save(path);
+    const std::vector<char> good = read_file(path);
+
+    const size_t SLOTS = 72;
+    uint64_t slot_count = read_field<uint64_t>(good, 40);
+    uint64_t table_capacity = read_field<uint64_t>(good, 48);
+    int32_t toy_count = read_field<int32_t>(good, 28);
+    size_t table = (SLOTS + slot_count * 4 + 7) & ~size_t(7);
+    size_t ids = (table + table_capacity * 12 + 7) & ~size_t(7);
+    size_t name_index = (ids + toy_count * 4 + 7) & ~size_t(7);
+    int32_t first_toy = read_field<int32_t>(good, SLOTS);
+
+    std::vector<std::pair<const char *, std::function<void(std::vector<char> &)>>> damages = {
+        {"capacity 0", [](std::vector<char> &raw) { write_field<int32_t>(raw, 16, 0); }},
+        {"negative capacity", [](std::vector<char> &raw) { write_field<int32_t>(raw, 16, -10); }},
+        {"last_item < -1", [](std::vector<char> &raw) { write_field<int32_t>(raw, 24, -5); }},
+        {"last_item off by one", [](std::vector<char> &raw) { write_field<int32_t>(raw, 24, read_field<int32_t>(raw, 24) - 1); }},
+        {"negative front_shift", [](std::vector<char> &raw) { write_field<int32_t>(raw, 32, -1); }},
+        {"shifted front_shift", [](std::vector<char> &raw) { write_field<int32_t>(raw, 32, read_field<int32_t>(raw, 32) + 1); }},
+        {"table size overflow", [](std::vector<char> &raw) { write_field<uint64_t>(raw, 48, uint64_t(1) << 62); }},
+        {"name bytes overflow", [](std::vector<char> &raw) { write_field<uint64_t>(raw, 64, ~uint64_t(0) - 8); }},
+        {"unknown slot ID", [](std::vector<char> &raw) { write_field<int32_t>(raw, SLOTS, 1000); }},
+        {"duplicated slot ID", [first_toy](std::vector<char> &raw) { write_field<int32_t>(raw, SLOTS + 4, first_toy); }},
+        {"record position", [first_toy, table, table_capacity](std::vector<char> &raw) {
+            for (size_t e = table; e < table + table_capacity * 12; e += 12) {
+                if (read_field<int32_t>(raw, e) == first_toy) {
+                    write_field<int32_t>(raw, e + 4, 1 << 30);
+                }
+            }
+        }},
+        {"sorted IDs out of order", [ids](std::vector<char> &raw) { write_field<int32_t>(raw, ids, 24); }},
+        {"unknown sorted ID", [ids, toy_count](std::vector<char> &raw) { write_field<int32_t>(raw, ids + (toy_count - 1) * 4, 1000); }},
+        {"name handle out of range", [name_index](std::vector<char> &raw) { write_field<uint32_t>(raw, name_index, 1000); }},
+        {"name entry for another toy", [name_index](std::vector<char> &raw) {
+            write_field<int32_t>(raw, name_index + 4, read_field<int32_t>(raw, name_index + 12));
+        }},
+        {"truncated file", [](std::vector<char> &raw) { raw.resize(raw.size() - 1); }},
+    };
+
+    int rejected = 0;
+    total = static_cast<int>(damages.size());
+    for (auto &damage : damages) {
+        std::vector<char> raw = good;
+        damage.second(raw);
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(raw.data(), static_cast<std::streamsize>(raw.size()));
+        try {
+            ToyShelf::load(path);
+            std::cout << "  not rejected: " << damage.first << std::endl;
+        } catch (const std::exception &) {
+            rejected++;
+        }
+    }
+    return rejected;
+}
+
+int main(int argc, char *argv[]) {
+    int toy_count = 1000000;
+    int capacity = 10;
+    int move_count = 1000000;
+    std::string path = "toy_shelf.snapshot";
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--toys") {
+            toy_count = std::stoi(argv[++i]);
+        } else if (arg == "--capacity") {
+            capacity = std::stoi(argv[++i]);
+        } else if (arg == "--moves") {
+            move_count = std::stoi(argv[++i]);
+        } else if (arg == "--file") {
+            path = argv[++i];
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<Toy> catalog;
+    for (int i = 0; i < toy_count; i++) {
+        catalog.emplace_back(i, "Toy" + std::to_string(i % 1000));
+    }
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick_toy(0, toy_count - 1);
+    std::vector<std::pair<int, int>> moves(move_count);
+    for (auto &move : moves) {
+        move = {pick_toy(rng), pick_toy(rng)};
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    ToyShelf replayed(capacity, catalog);
+    replayed.apply_moves(moves);
+    double replay_seconds = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    replayed.save(path);
+    double save_seconds = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    std::vector<char> raw = read_file(path);
+    double read_seconds = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    ToyShelf loaded = ToyShelf::load(path);
+    double load_seconds = seconds_since(start);
+
+    bool same = loaded.size() == replayed.size() && loaded.stand_count() == replayed.stand_count();
+    IdView a = replayed.view_shelf();
+    IdView b = loaded.view_shelf();
+    same = same && std::equal(a.begin(), a.end(), b.begin(), b.end());
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Toys: " << toy_count << ", moves: " << move_count << ", stands: " << replayed.stand_count() << std::endl;
+    std::cout << "Snapshot size:      " << raw.size() / (1024.0 * 1024.0) << " MB" << std::endl;
+    std::cout << "Replay (bulk+moves) " << replay_seconds << " s" << std::endl;
+    std::cout << "Save                " << save_seconds << " s" << std::endl;
+    std::cout << "Read file only      " << read_seconds << " s" << std::endl;
+    std::cout << "Load snapshot       " << load_seconds << " s" << std::endl;
+    std::cout << "Loaded shelf matches: " << (same ? "yes" : "no") << std::endl;
+
+    int damaged = 0;
+    int rejected = check_corrupt_snapshots(path + ".corrupt", damaged);
+    std::cout << "Corrupt snapshots rejected: " << rejected << "/" << damaged << std::endl;
+
+    return (same && rejected == damaged) ? 0 : 1;
+}
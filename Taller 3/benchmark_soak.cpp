@@ -0,0 +1,126 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "toy_shelf.h"
+
+// Prueba de resistencia (soak) de ToyShelf: aplica rondas de movimientos aleatorios sobre dos estanterías idénticas,
+// una sin compactar y otra con compactación automática, y muestra cómo evolucionan sus estanterías y su memoria.
+//
+// Cada movimiento lleva un juguete al azar debajo del juguete que quedó más abajo (con probabilidad --bottom-ratio)
+// o debajo de otro juguete al azar. Mover debajo del último agrega una estantería, así que sin compactar la
+// estantería crece sin límite; con compactación las estanterías que se vacían se recuperan. Se imprime una fila
+// cada --report-every rondas y al final el máximo de estanterías y memoria de cada mitad de la prueba: si la segunda
+// mitad no supera a la primera, la estantería compactada llegó a un estado estable.
+//
+// Uso: ./benchmark_soak [--toys N] [--capacity C] [--rounds R] [--moves M] [--bottom-ratio P] [--auto-ratio A]
+//                       [--report-every K]
+
+int main(int argc, char *argv[]) {
+    int toy_count = 100000;
+    int capacity = 10;
+    int rounds = 100;
+    int moves_per_round = 100000;
+    double bottom_ratio = 0.5;
+    double auto_ratio = 0.25;
+    int report_every = 5;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--toys") {
+            toy_count = std::stoi(argv[++i]);
+        } else if (arg == "--capacity") {
+            capacity = std::stoi(argv[++i]);
+        } else if (arg == "--rounds") {
+            rounds = std::stoi(argv[++i]);
+        } else if (arg == "--moves") {
+            moves_per_round = std::stoi(argv[++i]);
+        } else if (arg == "--bottom-ratio") {
+            bottom_ratio = std::stod(argv[++i]);
+        } else if (arg == "--auto-ratio") {
+            auto_ratio = std::stod(argv[++i]);
+        } else if (arg == "--report-every") {
+            report_every = std::stoi(argv[++i]);
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<Toy> catalog;
+    for (int i = 0; i < toy_count; i++) {
+        catalog.emplace_back(i, "Toy" + std::to_string(i % 100));
+    }
+
+    ToyShelf plain(capacity, catalog);
+    ToyShelf compacted(capacity, catalog);
+    compacted.set_auto_compact(auto_ratio);
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> pick_toy(0, toy_count - 1);
+    std::bernoulli_distribution pick_bottom(bottom_ratio);
+    int bottom = pick_toy(rng);
+
+    std::cout << std::setw(6) << "round" << std::setw(12) << "moves"
+              << std::setw(14) << "plain stands" << std::setw(14) << "plain KB"
+              << std::setw(14) << "auto stands" << std::setw(14) << "auto KB" << std::endl;
+
+    // Máximos de cada mitad de la prueba: [0] primera mitad, [1] segunda mitad
+    int max_plain_stands[2] = {0, 0}, max_auto_stands[2] = {0, 0};
+    size_t max_plain_bytes[2] = {0, 0}, max_auto_bytes[2] = {0, 0};
+
+    std::vector<std::pair<int, int>> moves(moves_per_round);
+    for (int round = 1; round <= rounds; round++) {
+        for (auto &move : moves) {
+            int y = pick_bottom(rng) ? bottom : pick_toy(rng);
+            int x;
+            do {
+                x = pick_toy(rng);
+            } while (x == y);
+            move = {x, y};
+            if (y == bottom) {
+                bottom = x;
+            }
+        }
+
+        plain.apply_moves(moves);
+        compacted.apply_moves(moves);
+
+        int half = 2 * round > rounds ? 1 : 0;
+        max_plain_stands[half] = std::max(max_plain_stands[half], plain.stand_count());
+        max_plain_bytes[half] = std::max(max_plain_bytes[half], plain.layout_bytes());
+        max_auto_stands[half] = std::max(max_auto_stands[half], compacted.stand_count());
+        max_auto_bytes[half] = std::max(max_auto_bytes[half], compacted.layout_bytes());
+
+        if (round % report_every == 0 || round == rounds) {
+            std::cout << std::setw(6) << round << std::setw(12) << static_cast<long long>(round) * moves_per_round
+                      << std::setw(14) << plain.stand_count() << std::setw(14) << plain.layout_bytes() / 1024
+                      << std::setw(14) << compacted.stand_count() << std::setw(14) << compacted.layout_bytes() / 1024
+                      << std::endl;
+        }
+    }
+
+    std::cout << std::endl;
+    std::cout << std::setw(12) << "max" << std::setw(14) << "plain stands" << std::setw(14) << "plain KB"
+              << std::setw(14) << "auto stands" << std::setw(14) << "auto KB" << std::endl;
+    const char *halves[2] = {"first half", "second half"};
+    for (int h = 0; h < 2; h++) {
+        std::cout << std::setw(12) << halves[h] << std::setw(14) << max_plain_stands[h]
+                  << std::setw(14) << max_plain_bytes[h] / 1024 << std::setw(14) << max_auto_stands[h]
+                  << std::setw(14) << max_auto_bytes[h] / 1024 << std::endl;
+    }
+
+    CompactionStats stats = plain.compact();
+    std::cout << std::endl;
+    std::cout << "Compacting the plain shelf at the end reclaimed " << stats.stands_reclaimed << " stands and "
+              << stats.bytes_reclaimed / 1024 << " KB." << std::endl;
+
+    return 0;
+}
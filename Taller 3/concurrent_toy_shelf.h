@@ -0,0 +1,278 @@
+#ifndef CONCURRENT_TOY_SHELF_H
+#define CONCURRENT_TOY_SHELF_H
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <deque>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <stdexcept>
+#include <cstdint>
+#include "id_index.h"
+#include "string_arena.h"
+#include "segmented_array.h"
+
+// Variante de ToyShelf que se puede usar desde varios hilos a la vez. Mantiene la misma disposición que ToyShelf
+// (add_toy inserta al frente y move_below deja un juguete debajo de otro), pero no imprime nada por operación.
+//
+// Bloqueos:
+//  - add_toy inserta al frente y desplaza todas las casillas, así que toma el bloqueo de la disposición en modo exclusivo.
+//  - move_below toma ese bloqueo en modo compartido y además bloquea solo las estanterías que toca (la del juguete
+//    que se mueve, la de referencia y la de destino), siempre en orden ascendente para que no haya interbloqueos.
+//    Las estanterías se reparten en STAND_LOCKS mutex (lock striping), así que dos estanterías distintas pueden
+//    compartir mutex.
+//  - Crear una estantería al final no requiere bloqueos: se publica el segmento de memoria con CAS y luego se
+//    incrementa el contador de estanterías con CAS.
+//  - view_shelf lee un registro de IDs que solo crece y publica su tamaño de forma atómica, así que no bloquea a
+//    quienes escriben y siempre devuelve el conjunto de IDs de un instante concreto.
+class ConcurrentToyShelf {
+private:
+    static constexpr int EMPTY_SLOT = -1;
+    static constexpr int STAND_LOCKS = 256;
+
+    struct alignas(64) StandLock {
+        std::mutex mutex;
+    };
+
+    const int capacity_per_stand;
+
+    // Las casillas se guardan por coordenada absoluta: la casilla lógica i está en i - front_shift.
+    // Insertar al frente solo mueve el inicio de la ventana, y nunca reubica casillas que otros hilos estén usando
+    SegmentedArray<int> slots;
+    int front_shift = 0;                       // Solo cambia con el bloqueo exclusivo
+    std::atomic<int> stands{0};
+    std::atomic<long long> last_hint{0};       // Cota superior (absoluta) de la última casilla ocupada
+
+    std::shared_mutex layout_mutex;
+    std::unique_ptr<StandLock[]> stand_locks;
+
+    // ID -> número de juguete (fijo desde que se agrega); la posición absoluta de cada juguete es atómica
+    IdIndex<int> toy_numbers;
+    std::deque<std::atomic<long long>> positions;
+    std::deque<uint32_t> name_handles;
+    StringArena names;
+
+    // Registro de IDs en orden de llegada, para las consultas ordenadas
+    SegmentedArray<int> id_log;
+    std::atomic<long long> published_ids{0};
+
+    // Última vista ordenada calculada (compartida por los lectores, protegida por view_mutex)
+    std::mutex view_mutex;
+    std::shared_ptr<const std::vector<int>> sorted_view = std::make_shared<const std::vector<int>>();
+
+    long long window_begin() const {
+        return -front_shift;
+    }
+
+    std::mutex& lock_for_stand(int stand) {
+        return stand_locks[stand % STAND_LOCKS].mutex;
+    }
+
+    // Última casilla ocupada (índice lógico). Solo se llama con el bloqueo exclusivo
+    int find_last_item() {
+        long long end = window_begin() + static_cast<long long>(stands.load()) * capacity_per_stand;
+        long long i = std::min(last_hint.load(), end - 1);
+        while (i >= window_begin() && slots[i] == EMPTY_SLOT) {
+            i--;
+        }
+        last_hint.store(i);
+        return static_cast<int>(i - window_begin());
+    }
+
+public:
+    /**
+     * @brief Crea una estantería vacía con la capacidad indicada por estante.
+     */
+    explicit ConcurrentToyShelf(int capacity_per_stand)
+        : capacity_per_stand(capacity_per_stand), slots(EMPTY_SLOT), stand_locks(new StandLock[STAND_LOCKS]),
+          id_log(EMPTY_SLOT) {
+        last_hint.store(window_begin() - 1);
+    }
+
+    /**
+     * @brief Inserta un juguete al frente, igual que ToyShelf::add_toy (sin imprimir).
+     * @throws std::invalid_argument si el ID ya existe o es el reservado para placeholders.
+     */
+    void add_toy(int id, const std::string &name) {
+        std::unique_lock<std::shared_mutex> layout(layout_mutex);
+
+        if (id == EMPTY_SLOT) {
+            throw std::invalid_argument("El ID -1 está reservado para los placeholders.");
+        }
+        if (toy_numbers.find(id) != nullptr) {
+            throw std::invalid_argument("Ya existe un juguete con el ID " + std::to_string(id) + ".");
+        }
+
+        int last = find_last_item();
+
+        // Igual que en ToyShelf: si el último elemento cierra una estantería, se agrega una; si no, el placeholder
+        // final sale de la ventana (en coordenadas absolutas la ventana se corre una casilla hacia el frente)
+        long long begin = window_begin() - 1;
+        int new_stands = stands.load() + (((last + 1) % capacity_per_stand == 0) ? 1 : 0);
+        slots.ensure(begin, begin + static_cast<long long>(new_stands) * capacity_per_stand);
+        front_shift++;
+        slots[begin] = id;
+        stands.store(new_stands);
+        if (last == -1) {
+            last_hint.store(begin);
+        }
+
+        toy_numbers.insert(id, static_cast<int>(positions.size()));
+        positions.emplace_back(begin);
+        name_handles.push_back(names.intern(name));
+
+        long long n = published_ids.load(std::memory_order_relaxed);
+        id_log.ensure(n, n + 1);
+        id_log[n] = id;
+        published_ids.store(n + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Mueve el juguete x a la casilla inferior de y, igual que ToyShelf::move_below (sin imprimir).
+     * @return false si alguno de los IDs no existe.
+     */
+    bool move_below(int x, int y) {
+        std::shared_lock<std::shared_mutex> layout(layout_mutex);
+
+        const int *x_number = toy_numbers.find(x);
+        const int *y_number = toy_numbers.find(y);
+        if (x_number == nullptr || y_number == nullptr) {
+            return false;
+        }
+        std::atomic<long long> &x_pos = positions[*x_number];
+        std::atomic<long long> &y_pos = positions[*y_number];
+
+        while (true) {
+            long long x_abs = x_pos.load(std::memory_order_acquire);
+            long long y_abs = y_pos.load(std::memory_order_acquire);
+            long long target_abs = y_abs + capacity_per_stand;
+            int x_stand = static_cast<int>((x_abs - window_begin()) / capacity_per_stand);
+            int y_stand = static_cast<int>((y_abs - window_begin()) / capacity_per_stand);
+            int target_stand = static_cast<int>((target_abs - window_begin()) / capacity_per_stand);
+
+            // Bloquear las estanterías de x, de y y de destino en orden fijo (por dirección de mutex, sin repetir).
+            // La de y también hace falta: sin ella otro hilo podría mover y entre la verificación y el intercambio
+            std::mutex *needed[3] = {&lock_for_stand(x_stand), &lock_for_stand(y_stand), &lock_for_stand(target_stand)};
+            auto order = [](std::mutex *&lower, std::mutex *&upper) {
+                if (std::less<std::mutex *>()(upper, lower)) {
+                    std::swap(lower, upper);
+                }
+            };
+            order(needed[0], needed[1]);
+            order(needed[1], needed[2]);
+            order(needed[0], needed[1]);
+            std::unique_lock<std::mutex> locks[3];
+            for (int i = 0; i < 3; i++) {
+                if (i == 0 || needed[i] != needed[i - 1]) {
+                    locks[i] = std::unique_lock<std::mutex>(*needed[i]);
+                }
+            }
+
+            // Si otro hilo movió x o y mientras se tomaban los bloqueos, volver a empezar
+            if (x_pos.load(std::memory_order_acquire) != x_abs || y_pos.load(std::memory_order_acquire) != y_abs) {
+                continue;
+            }
+
+            // Crea una estantería si es necesario, sin bloqueos: si otro hilo ya la creó el CAS falla y no se repite
+            int current = stands.load();
+            while (target_abs >= window_begin() + static_cast<long long>(current) * capacity_per_stand) {
+                long long stand_begin = window_begin() + static_cast<long long>(current) * capacity_per_stand;
+                slots.ensure(stand_begin, stand_begin + capacity_per_stand);
+                stands.compare_exchange_weak(current, current + 1);
+            }
+
+            int displaced = slots[target_abs];
+            if (displaced != EMPTY_SLOT) {
+                positions[*toy_numbers.find(displaced)].store(x_abs, std::memory_order_release);
+            }
+            slots[target_abs] = slots[x_abs];
+            slots[x_abs] = displaced;
+            x_pos.store(target_abs, std::memory_order_release);
+
+            long long hint = last_hint.load();
+            while (target_abs > hint && !last_hint.compare_exchange_weak(hint, target_abs)) {
+            }
+            return true;
+        }
+    }
+
+    /**
+     * @brief Devuelve los IDs ordenados de forma ascendente en un instante concreto. No bloquea a add_toy ni a
+     *        move_below: solo ordena los IDs que llegaron desde la última consulta y los mezcla con la vista anterior.
+     */
+    std::shared_ptr<const std::vector<int>> view_shelf() {
+        std::lock_guard<std::mutex> guard(view_mutex);
+        long long n = published_ids.load(std::memory_order_acquire);
+        long long known = static_cast<long long>(sorted_view->size());
+        if (n == known) {
+            return sorted_view;
+        }
+
+        std::vector<int> fresh;
+        for (long long i = known; i < n; i++) {
+            fresh.push_back(id_log[i]);
+        }
+        std::sort(fresh.begin(), fresh.end());
+
+        auto merged = std::make_shared<std::vector<int>>();
+        merged->reserve(n);
+        std::merge(sorted_view->begin(), sorted_view->end(), fresh.begin(), fresh.end(), std::back_inserter(*merged));
+        sorted_view = merged;
+        return sorted_view;
+    }
+
+    /**
+     * @brief Estantería y casilla donde está un juguete, como {estantería, casilla}.
+     * @throws std::out_of_range si el ID no existe.
+     */
+    std::pair<int, int> locate(int id) {
+        std::shared_lock<std::shared_mutex> layout(layout_mutex);
+        const int *number = toy_numbers.find(id);
+        if (number == nullptr) {
+            throw std::out_of_range("No existe un juguete con el ID " + std::to_string(id) + ".");
+        }
+        long long index = positions[*number].load(std::memory_order_acquire) - window_begin();
+        return {static_cast<int>(index / capacity_per_stand), static_cast<int>(index % capacity_per_stand)};
+    }
+
+    /**
+     * @brief Número de estanterías.
+     */
+    int stand_count() const {
+        return stands.load();
+    }
+
+    /**
+     * @brief Imprime la estantería con el mismo formato que ToyShelf::print (bloquea a los escritores mientras imprime).
+     */
+    void print() {
+        std::unique_lock<std::shared_mutex> layout(layout_mutex);
+        long long size = static_cast<long long>(stands.load()) * capacity_per_stand;
+        for (long long i = 0; i < size; i++) {
+            if (i % capacity_per_stand == 0) {
+                std::cout << std::endl;
+                std::cout << std::string(12 * capacity_per_stand, '-') << std::endl;
+            }
+            int id = slots[window_begin() + i];
+            std::cout << std::setfill(' ') << std::setw(12);
+            if (id == EMPTY_SLOT) {
+                std::cout << "**";
+            } else {
+                std::cout << names.get(name_handles[*toy_numbers.find(id)]);
+            }
+        }
+        std::cout << std::endl;
+        std::cout << std::string(12 * capacity_per_stand, '-') << std::endl;
+        std::cout << "Stands: " << stands.load() << std::endl;
+        std::cout << std::endl;
+    }
+};
+
+#endif // CONCURRENT_TOY_SHELF_H
@@ -0,0 +1,201 @@
+#ifndef ID_INDEX_H
+#define ID_INDEX_H
+
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <cstring>
+#include <type_traits>
+
+// Tabla hash de direccionamiento abierto (sondeo lineal) que asocia el ID de un juguete a un valor.
+// El ID -1 está reservado para los placeholders y se usa como marca de casilla vacía.
+template<class V>
+class IdIndex {
+private:
+    struct Entry {
+        int key;
+        V value;
+    };
+
+    static constexpr int EMPTY_KEY = -1;
+
+    std::vector<Entry> table;   // Capacidad siempre potencia de dos
+    size_t count = 0;           // Número de claves almacenadas
+
+    /**
+     * @brief Mezcla los bits del ID para repartir claves consecutivas por la tabla.
+     */
+    static size_t hash(int key) {
+        uint64_t h = static_cast<uint32_t>(key);
+        h *= 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(h >> 32);
+    }
+
+    /**
+     * @brief Busca la casilla de una clave, o la casilla vacía donde debería insertarse.
+     */
+    size_t probe(int key) const {
+        size_t mask = table.size() - 1;
+        size_t i = hash(key) & mask;
+        while (table[i].key != EMPTY_KEY && table[i].key != key) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    /**
+     * @brief Duplica la capacidad y reinserta todas las claves.
+     */
+    void rehash(size_t new_capacity) {
+        std::vector<Entry> old = std::move(table);
+        table.assign(new_capacity, Entry{EMPTY_KEY, V()});
+        for (const Entry& e : old) {
+            if (e.key != EMPTY_KEY) {
+                table[probe(e.key)] = e;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor por defecto. Crea un índice vacío con capacidad mínima.
+     */
+    IdIndex() : table(16, Entry{EMPTY_KEY, V()}) {}
+
+    /**
+     * @brief Obtiene el número de IDs almacenados.
+     */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * @brief Reserva espacio para al menos n IDs sin volver a construir la tabla.
+     */
+    void reserve(size_t n) {
+        size_t capacity = table.size();
+        while (4 * n > 3 * capacity) {
+            capacity *= 2;
+        }
+        if (capacity != table.size()) {
+            rehash(capacity);
+        }
+    }
+
+    /**
+     * @brief Número de casillas de la tabla (potencia de dos).
+     */
+    size_t capacity() const {
+        return table.size();
+    }
+
+    /**
+     * @brief Bytes de cada casilla de la tabla.
+     */
+    static constexpr size_t entry_bytes() {
+        return sizeof(Entry);
+    }
+
+    /**
+     * @brief Bytes de la tabla interna, para guardarla tal cual en un snapshot.
+     */
+    size_t table_bytes() const {
+        return table.size() * sizeof(Entry);
+    }
+
+    /**
+     * @brief Puntero a la tabla interna (table_bytes() bytes). Como el hash no depende de la ejecución,
+     *        la tabla se puede volver a cargar sin reinsertar las claves.
+     */
+    const void *table_data() const {
+        static_assert(std::is_trivially_copyable<Entry>::value, "Solo se pueden copiar tablas de valores triviales");
+        return table.data();
+    }
+
+    /**
+     * @brief Reemplaza la tabla por una copiada con table_data() (de "capacity" casillas).
+     * @throws std::invalid_argument si la capacidad no es potencia de dos o la tabla supera el factor de carga.
+     */
+    void assign_table(const void *data, size_t capacity) {
+        static_assert(std::is_trivially_copyable<Entry>::value, "Solo se pueden copiar tablas de valores triviales");
+        if (capacity < 16 || (capacity & (capacity - 1)) != 0) {
+            throw std::invalid_argument("La capacidad de la tabla debe ser una potencia de dos.");
+        }
+        table.resize(capacity);
+        std::memcpy(table.data(), data, capacity * sizeof(Entry));
+        count = 0;
+        for (const Entry& e : table) {
+            if (e.key != EMPTY_KEY) {
+                count++;
+            }
+        }
+        if (4 * count > 3 * capacity) {
+            throw std::invalid_argument("La tabla supera el factor de carga máximo.");
+        }
+    }
+
+    /**
+     * @brief Recorre en orden la tabla cargada con assign_table y verifica cada ID: debe estar en la casilla donde lo
+     *        encontraría find (así se descartan IDs repetidos o fuera de su secuencia de sondeo) y cumplir
+     *        check(id, valor). Se detiene en el primero que no cumpla.
+     * @return true si todos los IDs son válidos.
+     */
+    template<class F>
+    bool check_entries(F check) const {
+        for (size_t i = 0; i < table.size(); i++) {
+            const Entry& e = table[i];
+            if (e.key != EMPTY_KEY && (probe(e.key) != i || !check(e.key, e.value))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Busca el valor asociado a un ID.
+     * @return Puntero al valor, o nullptr si el ID no está en el índice.
+     */
+    V* find(int key) {
+        if (key == EMPTY_KEY) {
+            return nullptr;
+        }
+        Entry& e = table[probe(key)];
+        return e.key == key ? &e.value : nullptr;
+    }
+
+    const V* find(int key) const {
+        return const_cast<IdIndex*>(this)->find(key);
+    }
+
+    /**
+     * @brief Pide al procesador que traiga a caché la casilla inicial de un ID que se va a consultar pronto.
+     */
+    void prefetch(int key) const {
+        __builtin_prefetch(&table[hash(key) & (table.size() - 1)]);
+    }
+
+    /**
+     * @brief Inserta un ID nuevo.
+     * @return false si el ID ya existía (el índice no se modifica).
+     * @throws std::invalid_argument si el ID es el reservado para placeholders.
+     */
+    bool insert(int key, const V& value) {
+        if (key == EMPTY_KEY) {
+            throw std::invalid_argument("El ID -1 está reservado para los placeholders.");
+        }
+        // Factor de carga máximo de 3/4 para mantener los sondeos cortos
+        if (4 * (count + 1) > 3 * table.size()) {
+            rehash(table.size() * 2);
+        }
+        Entry& e = table[probe(key)];
+        if (e.key == key) {
+            return false;
+        }
+        e.key = key;
+        e.value = value;
+        count++;
+        return true;
+    }
+};
+
+#endif // ID_INDEX_H
@@ -0,0 +1,71 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <stdexcept>
+#include <cstddef>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Archivo proyectado en memoria (solo lectura). El sistema operativo carga las páginas a medida que se leen,
+// así que no hay copia intermedia a un buffer propio. Se libera la proyección al destruir el objeto.
+class MappedFile {
+private:
+    const unsigned char *bytes = nullptr;
+    size_t length = 0;
+
+public:
+    /**
+     * @brief Proyecta el archivo completo en memoria.
+     * @throws std::runtime_error si no se puede abrir o proyectar.
+     */
+    explicit MappedFile(const std::string &path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("No se pudo abrir " + path + ".");
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("No se pudo leer el tamaño de " + path + ".");
+        }
+        length = static_cast<size_t>(info.st_size);
+        if (length > 0) {
+            void *mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("No se pudo proyectar " + path + " en memoria.");
+            }
+            bytes = static_cast<const unsigned char *>(mapped);
+            ::madvise(mapped, length, MADV_SEQUENTIAL);
+        }
+        ::close(fd);   // La proyección sigue siendo válida sin el descriptor
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+        if (bytes != nullptr) {
+            ::munmap(const_cast<unsigned char *>(bytes), length);
+        }
+    }
+
+    /**
+     * @brief Puntero al primer byte del archivo.
+     */
+    const unsigned char *data() const {
+        return bytes;
+    }
+
+    /**
+     * @brief Tamaño del archivo en bytes.
+     */
+    size_t size() const {
+        return length;
+    }
+};
+
+#endif // MAPPED_FILE_H
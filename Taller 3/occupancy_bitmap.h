@@ -0,0 +1,184 @@
+#ifndef OCCUPANCY_BITMAP_H
+#define OCCUPANCY_BITMAP_H
+
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include "slot_buffer.h"
+
+// Mapa de bits de ocupación (1 = juguete, 0 = placeholder) que crece por ambos extremos igual que SlotBuffer.
+// Los bits se agrupan en palabras de 64, así que buscar la última casilla ocupada avanza 64 casillas por
+// instrucción (bit-scan) en lugar de una por una, y agregar o quitar casillas en bloque escribe palabras enteras.
+class OccupancyBitmap {
+private:
+    static constexpr int WORD_BITS = 64;
+
+    SlotBuffer<uint64_t> words;   // Palabras del mapa; el bit "head" de la palabra 0 es la casilla 0
+    size_t head = 0;              // Bit de la primera casilla dentro de la palabra 0
+    size_t bits = 0;              // Número de casillas
+
+    uint64_t& word_of(size_t i, uint64_t& mask) {
+        size_t bit = head + i;
+        mask = uint64_t(1) << (bit % WORD_BITS);
+        return words[bit / WORD_BITS];
+    }
+
+public:
+    /**
+     * @brief Número de casillas representadas.
+     */
+    size_t size() const {
+        return bits;
+    }
+
+    /**
+     * @brief Indica si la casilla i está ocupada.
+     */
+    bool test(size_t i) const {
+        size_t bit = head + i;
+        return (words[bit / WORD_BITS] >> (bit % WORD_BITS)) & 1;
+    }
+
+    /**
+     * @brief Marca la casilla i como ocupada o libre.
+     */
+    void set(size_t i, bool occupied) {
+        uint64_t mask;
+        uint64_t& word = word_of(i, mask);
+        word = occupied ? (word | mask) : (word & ~mask);
+    }
+
+    /**
+     * @brief Inserta una casilla al frente.
+     */
+    void push_front(bool occupied) {
+        if (head == 0) {
+            words.push_front(0);
+            head = WORD_BITS;
+        }
+        head--;
+        bits++;
+        set(0, occupied);
+    }
+
+    /**
+     * @brief Inserta n casillas ocupadas al frente. Completa la palabra 0 y luego antepone palabras enteras.
+     */
+    void prepend_set(size_t n) {
+        size_t in_first = std::min(n, head);   // Bits libres de la palabra 0 antes de la casilla 0
+        if (in_first > 0) {
+            words[0] |= ((in_first == WORD_BITS) ? ~uint64_t(0) : ((uint64_t(1) << in_first) - 1)) << (head - in_first);
+            head -= in_first;
+            bits += in_first;
+            n -= in_first;
+        }
+        if (n == 0) {
+            return;
+        }
+        size_t partial = n % WORD_BITS;
+        std::vector<uint64_t> front((n + WORD_BITS - 1) / WORD_BITS, ~uint64_t(0));
+        if (partial != 0) {
+            front[0] = ~uint64_t(0) << (WORD_BITS - partial);   // Solo los bits altos de la primera palabra
+        }
+        words.prepend(front.data(), front.size());
+        head = (WORD_BITS - partial) % WORD_BITS;
+        bits += n;
+    }
+
+    /**
+     * @brief Agrega n casillas libres al final (una estantería completa se agrega con una sola reserva).
+     */
+    void append_free(size_t n) {
+        size_t needed_words = (head + bits + n + WORD_BITS - 1) / WORD_BITS;
+        if (needed_words > words.size()) {
+            words.append(needed_words - words.size(), 0);
+        }
+        bits += n;
+    }
+
+    /**
+     * @brief Cambia el número de casillas quitando del final o agregando casillas libres.
+     */
+    void resize_free(size_t n) {
+        if (n > bits) {
+            append_free(n - bits);
+            return;
+        }
+        // Se limpian de una vez los bits que salen de la última palabra que queda y se descartan las palabras enteras
+        size_t end_bit = head + n;
+        size_t kept_words = (end_bit + WORD_BITS - 1) / WORD_BITS;
+        if (end_bit % WORD_BITS != 0) {
+            words[kept_words - 1] &= (uint64_t(1) << (end_bit % WORD_BITS)) - 1;
+        }
+        words.resize(kept_words, 0);
+        bits = n;
+    }
+
+    /**
+     * @brief Libera las palabras reservadas que no se usan.
+     */
+    void shrink_to_fit() {
+        words.shrink_to_fit();
+    }
+
+    /**
+     * @brief Elimina la última casilla.
+     */
+    void pop_back() {
+        set(bits - 1, false);
+        bits--;
+        if ((head + bits + WORD_BITS - 1) / WORD_BITS < words.size()) {
+            words.pop_back();
+        }
+    }
+
+    /**
+     * @brief Busca la última casilla ocupada en [0, from].
+     * @return Índice de la casilla, o -1 si no hay ninguna.
+     */
+    long long find_last_set(long long from) const {
+        if (from < 0) {
+            return -1;
+        }
+        long long bit = head + from;
+        long long w = bit / WORD_BITS;
+        uint64_t word = words[w] & (~uint64_t(0) >> (WORD_BITS - 1 - bit % WORD_BITS));
+        while (true) {
+            if (w == 0) {
+                word &= ~uint64_t(0) << head;   // Ignorar los bits anteriores a la casilla 0
+            }
+            if (word != 0) {
+                return w * WORD_BITS + (WORD_BITS - 1 - __builtin_clzll(word)) - static_cast<long long>(head);
+            }
+            if (w == 0) {
+                return -1;
+            }
+            word = words[--w];
+        }
+    }
+
+    /**
+     * @brief Cuenta las casillas ocupadas en [first, last).
+     */
+    size_t count(size_t first, size_t last) const {
+        size_t total = 0;
+        for (size_t i = first; i < last;) {
+            size_t bit = head + i;
+            size_t offset = bit % WORD_BITS;
+            size_t take = std::min<size_t>(WORD_BITS - offset, last - i);
+            uint64_t mask = (take == WORD_BITS) ? ~uint64_t(0) : ((uint64_t(1) << take) - 1) << offset;
+            total += __builtin_popcountll(words[bit / WORD_BITS] & mask);
+            i += take;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Bytes reservados por el mapa.
+     */
+    size_t capacity_bytes() const {
+        return words.capacity_bytes();
+    }
+};
+
+#endif // OCCUPANCY_BITMAP_H
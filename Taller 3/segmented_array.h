@@ -0,0 +1,84 @@
+#ifndef SEGMENTED_ARRAY_H
+#define SEGMENTED_ARRAY_H
+
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+// Arreglo dividido en segmentos de tamaño fijo que nunca se mueven. Acepta índices negativos (crece hacia
+// ambos lados) y los segmentos se crean sin bloqueos: varios hilos pueden pedir el mismo segmento y solo uno
+// lo publica. Como los elementos no se reubican, un hilo puede leer o escribir casillas mientras otro agrega segmentos.
+template<class T>
+class SegmentedArray {
+private:
+    static constexpr int SEGMENT_BITS = 12;
+    static constexpr long long SEGMENT_SIZE = 1LL << SEGMENT_BITS;
+    static constexpr long long DIRECTORY_SIZE = 1LL << 16;
+    static constexpr long long ORIGIN = (DIRECTORY_SIZE / 2) * SEGMENT_SIZE;   // Índice 0 queda en el segmento central
+
+    std::unique_ptr<std::atomic<T*>[]> directory;
+    T fill;   // Valor inicial de las casillas de un segmento nuevo
+
+    static long long segment_of(long long i) {
+        return (i + ORIGIN) >> SEGMENT_BITS;
+    }
+
+public:
+    /**
+     * @brief Crea un arreglo vacío; cada segmento nuevo se llena con "fill".
+     */
+    explicit SegmentedArray(const T& fill) : directory(new std::atomic<T*>[DIRECTORY_SIZE]), fill(fill) {
+        for (long long s = 0; s < DIRECTORY_SIZE; s++) {
+            directory[s].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    SegmentedArray(const SegmentedArray&) = delete;
+    SegmentedArray& operator=(const SegmentedArray&) = delete;
+
+    ~SegmentedArray() {
+        for (long long s = 0; s < DIRECTORY_SIZE; s++) {
+            delete[] directory[s].load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Garantiza que existan los segmentos de las casillas [first, last).
+     * @throws std::length_error si el rango se sale del directorio.
+     */
+    void ensure(long long first, long long last) {
+        if (first >= last) {
+            return;
+        }
+        long long first_segment = segment_of(first);
+        long long last_segment = segment_of(last - 1);
+        if (first_segment < 0 || last_segment >= DIRECTORY_SIZE) {
+            throw std::length_error("La estantería superó la capacidad máxima del arreglo segmentado.");
+        }
+        for (long long s = first_segment; s <= last_segment; s++) {
+            if (directory[s].load(std::memory_order_acquire) != nullptr) {
+                continue;
+            }
+            T* segment = new T[SEGMENT_SIZE];
+            std::fill(segment, segment + SEGMENT_SIZE, fill);
+            T* expected = nullptr;
+            if (!directory[s].compare_exchange_strong(expected, segment, std::memory_order_acq_rel)) {
+                delete[] segment;   // Otro hilo publicó el segmento primero
+            }
+        }
+    }
+
+    /**
+     * @brief Accede a la casilla i (su segmento debe existir).
+     */
+    T& operator[](long long i) {
+        return directory[segment_of(i)].load(std::memory_order_acquire)[(i + ORIGIN) & (SEGMENT_SIZE - 1)];
+    }
+
+    const T& operator[](long long i) const {
+        return directory[segment_of(i)].load(std::memory_order_acquire)[(i + ORIGIN) & (SEGMENT_SIZE - 1)];
+    }
+};
+
+#endif // SEGMENTED_ARRAY_H
@@ -0,0 +1,138 @@
+#ifndef SLOT_BUFFER_H
+#define SLOT_BUFFER_H
+
+#include <vector>
+#include <algorithm>
+
+// Arreglo contiguo que crece por ambos extremos (gap buffer). Insertar al frente o al final es O(1) amortizado
+// y los elementos quedan contiguos en memoria, por lo que recorrerlos es una pasada lineal.
+template<class T>
+class SlotBuffer {
+private:
+    std::vector<T> storage;   // Memoria reservada; los elementos válidos están en [head, tail)
+    size_t head = 0;
+    size_t tail = 0;
+
+    /**
+     * @brief Reubica los elementos en un bloque más grande dejando espacio libre en ambos extremos.
+     * @param front_extra Espacio mínimo que se necesita al frente.
+     * @param back_extra Espacio mínimo que se necesita al final.
+     */
+    void grow(size_t front_extra, size_t back_extra) {
+        size_t needed = size() + front_extra + back_extra;
+        size_t capacity = std::max<size_t>(16, 2 * needed);
+        size_t new_head = front_extra + (capacity - needed) / 2;
+
+        std::vector<T> bigger(capacity);
+        std::copy(storage.begin() + head, storage.begin() + tail, bigger.begin() + new_head);
+        tail = new_head + size();
+        head = new_head;
+        storage.swap(bigger);
+    }
+
+public:
+    /**
+     * @brief Obtiene el número de elementos.
+     */
+    size_t size() const {
+        return tail - head;
+    }
+
+    bool empty() const {
+        return head == tail;
+    }
+
+    T& operator[](size_t i) {
+        return storage[head + i];
+    }
+
+    const T& operator[](size_t i) const {
+        return storage[head + i];
+    }
+
+    /**
+     * @brief Puntero al primer elemento; los size() elementos son contiguos.
+     */
+    const T* data() const {
+        return storage.data() + head;
+    }
+
+    /**
+     * @brief Bytes reservados por el buffer (incluye el espacio libre en los extremos).
+     */
+    size_t capacity_bytes() const {
+        return storage.capacity() * sizeof(T);
+    }
+
+    /**
+     * @brief Inserta un elemento al frente.
+     */
+    void push_front(const T& value) {
+        if (head == 0) {
+            grow(1, 0);
+        }
+        storage[--head] = value;
+    }
+
+    /**
+     * @brief Inserta n elementos al frente conservando su orden (values[0] queda como primer elemento).
+     */
+    void prepend(const T* values, size_t n) {
+        if (head < n) {
+            grow(n, 0);
+        }
+        head -= n;
+        std::copy(values, values + n, storage.begin() + head);
+    }
+
+    /**
+     * @brief Inserta un elemento al final.
+     */
+    void push_back(const T& value) {
+        if (tail == storage.size()) {
+            grow(0, 1);
+        }
+        storage[tail++] = value;
+    }
+
+    /**
+     * @brief Inserta n copias de un valor al final con una sola reubicación como máximo.
+     */
+    void append(size_t n, const T& value) {
+        if (tail + n > storage.size()) {
+            grow(0, n);
+        }
+        std::fill(storage.begin() + tail, storage.begin() + tail + n, value);
+        tail += n;
+    }
+
+    /**
+     * @brief Cambia el tamaño quitando elementos del final o agregando copias de "value".
+     */
+    void resize(size_t n, const T& value) {
+        if (n > size()) {
+            append(n - size(), value);
+        } else {
+            tail = head + n;
+        }
+    }
+
+    /**
+     * @brief Libera el espacio libre de ambos extremos.
+     */
+    void shrink_to_fit() {
+        std::vector<T> exact(storage.begin() + head, storage.begin() + tail);
+        storage.swap(exact);
+        tail -= head;
+        head = 0;
+    }
+
+    /**
+     * @brief Elimina el último elemento.
+     */
+    void pop_back() {
+        --tail;
+    }
+};
+
+#endif // SLOT_BUFFER_H
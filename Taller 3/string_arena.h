@@ -0,0 +1,85 @@
+#ifndef STRING_ARENA_H
+#define STRING_ARENA_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+#include <cstring>
+
+// Almacén de cadenas internadas. Cada nombre distinto se guarda una sola vez en bloques de memoria contiguos
+// y se identifica con un handle de 32 bits. Los bloques nunca se mueven, así que las vistas siguen siendo válidas.
+class StringArena {
+private:
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> blocks;   // Bloques donde se copian los caracteres
+    char *current = nullptr;                        // Bloque donde se están agregando cadenas
+    size_t current_used = BLOCK_SIZE;               // Bytes ocupados del bloque actual
+    std::vector<std::string_view> strings;          // handle -> cadena
+    std::unordered_map<std::string_view, uint32_t> handles;   // cadena -> handle (para no duplicar nombres)
+
+    /**
+     * @brief Copia los caracteres a un bloque y devuelve una vista que no se invalida.
+     */
+    std::string_view store(std::string_view str) {
+        if (str.empty()) {
+            return std::string_view();
+        }
+        if (str.size() > BLOCK_SIZE) {
+            // Las cadenas más grandes que un bloque reciben un bloque propio
+            blocks.emplace_back(new char[str.size()]);
+            std::memcpy(blocks.back().get(), str.data(), str.size());
+            return std::string_view(blocks.back().get(), str.size());
+        }
+        if (str.size() > BLOCK_SIZE - current_used) {
+            blocks.emplace_back(new char[BLOCK_SIZE]);
+            current = blocks.back().get();
+            current_used = 0;
+        }
+        char *dest = current + current_used;
+        std::memcpy(dest, str.data(), str.size());
+        current_used += str.size();
+        return std::string_view(dest, str.size());
+    }
+
+public:
+    StringArena() = default;
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+    StringArena(StringArena&&) = default;
+    StringArena& operator=(StringArena&&) = default;
+
+    /**
+     * @brief Devuelve el handle de una cadena, guardándola si es la primera vez que aparece.
+     */
+    uint32_t intern(std::string_view str) {
+        auto it = handles.find(str);
+        if (it != handles.end()) {
+            return it->second;
+        }
+        std::string_view stored = store(str);
+        uint32_t handle = static_cast<uint32_t>(strings.size());
+        strings.push_back(stored);
+        handles.emplace(stored, handle);
+        return handle;
+    }
+
+    /**
+     * @brief Obtiene la cadena asociada a un handle.
+     */
+    std::string_view get(uint32_t handle) const {
+        return strings[handle];
+    }
+
+    /**
+     * @brief Número de cadenas distintas almacenadas.
+     */
+    size_t size() const {
+        return strings.size();
+    }
+};
+
+#endif // STRING_ARENA_H
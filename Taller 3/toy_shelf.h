@@ -0,0 +1,787 @@
+#ifndef TOY_SHELF_H
+#define TOY_SHELF_H
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <iterator>
+#include <cstddef>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <string_view>
+#include <fstream>
+#include "id_index.h"
+#include "slot_buffer.h"
+#include "occupancy_bitmap.h"
+#include "string_arena.h"
+#include "mapped_file.h"
+
+// Struct para mantener relación entre ID y nombre
+struct Toy {
+    int id;
+    std::string name;
+    
+    Toy(int id, const std::string &name) : id(id), name(name) { }
+};
+
+// Vista de solo lectura sobre los IDs ordenados de la estantería. No copia los IDs: recorre el vector interno
+// hacia adelante (ascendente) o hacia atrás (descendente). Deja de ser válida al agregar juguetes.
+class IdView {
+	public:
+		class iterator {
+			private:
+				const int *ptr; // En sentido descendente apunta una posición después del elemento actual
+				int step;
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = int;
+				using difference_type = std::ptrdiff_t;
+				using pointer = const int *;
+				using reference = const int &;
+				
+				iterator(const int *ptr, int step) : ptr(ptr), step(step) { }
+				const int &operator*() const { return (step > 0) ? *ptr : *(ptr - 1); }
+				iterator &operator++() { ptr += step; return *this; }
+				bool operator==(const iterator &other) const { return ptr == other.ptr; }
+				bool operator!=(const iterator &other) const { return ptr != other.ptr; }
+		};
+		
+		IdView(const int *first, const int *last, bool rev) : first(first), last(last), rev(rev) { }
+		
+		iterator begin() const { return rev ? iterator(last, -1) : iterator(first, 1); }
+		iterator end() const { return rev ? iterator(first, -1) : iterator(last, 1); }
+		size_t size() const { return last - first; }
+		bool empty() const { return first == last; }
+		
+	private:
+		const int *first;
+		const int *last;
+		bool rev;
+};
+
+// Resultado de ToyShelf::apply_moves
+struct MoveBatchResult {
+    int applied = 0; // Movimientos aplicados
+    std::vector<size_t> failed; // Posiciones (dentro del lote) de los movimientos con algún ID inexistente
+};
+
+// Ubicación de un juguete: estantería (0 es la superior) y casilla dentro de ella
+struct SlotLocation {
+    int stand;
+    int slot;
+};
+
+// Resultado de ToyShelf::compact
+struct CompactionStats {
+    int stands_reclaimed = 0; // Estanterías vacías eliminadas
+    size_t bytes_reclaimed = 0; // Memoria liberada por la disposición de casillas
+};
+
+// Clase para manejar la base de datos
+class ToyShelf {
+	private:
+		static constexpr int EMPTY_SLOT = -1; // ID que marca un placeholder
+		
+		// Datos de cada juguete que no dependen de la casilla: posición y handle del nombre internado
+		struct ToyRecord {
+		    int position;
+		    uint32_t name;
+		};
+		
+		SlotBuffer<int> slot_ids; // Base de datos: ID de cada casilla, contiguos (los placeholders son EMPTY_SLOT). Insertar al frente es O(1)
+		OccupancyBitmap occupied; // Un bit por casilla de slot_ids: permite saltar 64 placeholders de una vez
+		StringArena names; // Nombres internados; los placeholders no guardan ninguna cadena
+		std::vector<int> ids; // IDs ordenados de forma ascendente, para no tener que iterar para limpiar los placeholders
+		std::vector<int> pending_ids; // IDs agregados desde la última consulta, aún sin mezclar en "ids"
+		
+		// Índice de nombres: pares (nombre, ID) ordenados por nombre y luego por ID, para buscar por prefijo.
+		// Igual que con los IDs, los juguetes nuevos esperan en pending_names hasta la siguiente consulta
+		struct NameEntry {
+		    uint32_t name;
+		    int id;
+		};
+		std::vector<NameEntry> name_index;
+		std::vector<NameEntry> pending_names;
+		int capacity_per_stand; // Capacidad de cada estantería
+		int stands = 0;
+		int last_item = -1; // Índice del último elemento que no es un placeholder (-1 si la estantería está vacía)
+		int toy_count = 0; // Número de juguetes (casillas que no son placeholders)
+		
+		// Índice ID -> posición en la estantería y nombre. Se guarda la posición relativa a front_shift (número de inserciones al frente),
+		// así insertar al frente no obliga a actualizar las posiciones del resto de juguetes ni agregar estanterías al final
+		IdIndex<ToyRecord> records;
+		int front_shift = 0;
+		
+		// Compactación automática: si está activa, al crecer la estantería se revisa la proporción de estanterías vacías.
+		// Para que el costo sea O(1) amortizado la revisión solo ocurre cuando el número de estanterías se duplica
+		static constexpr int MIN_COMPACT_CHECK = 8;
+		double auto_compact_ratio = 0; // 0 = desactivada
+		int next_compact_check = 0;
+		
+		bool verbose = true; // add_toy y move_below imprimen cada operación
+		
+		// Snapshot binario (save/load). Cabecera seguida de secciones alineadas a 8 bytes, en este orden:
+		// IDs de las casillas, tabla del índice de registros, IDs ordenados, índice de nombres,
+		// desplazamientos de los nombres (name_count + 1) y caracteres de los nombres
+		static constexpr uint32_t SNAPSHOT_VERSION = 1;
+		static constexpr uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304; // Detecta archivos escritos en otra arquitectura
+		
+		struct SnapshotHeader {
+		    char magic[8];
+		    uint32_t version;
+		    uint32_t byte_order;
+		    int32_t capacity_per_stand;
+		    int32_t stands;
+		    int32_t last_item;
+		    int32_t toy_count;
+		    int32_t front_shift;
+		    uint32_t reserved;
+		    uint64_t slot_count;
+		    uint64_t table_capacity;
+		    uint64_t name_count;
+		    uint64_t name_bytes;
+		};
+		
+		// Desplazamiento de cada sección dentro del archivo
+		struct SnapshotLayout {
+		    uint64_t slots, table, ids, name_index, name_offsets, name_chars, end;
+		};
+		
+		// Aritmética del layout con control de desbordamiento: los tamaños vienen de la cabecera de un archivo
+		// que puede estar dañado, y un desplazamiento que da la vuelta pasaría la comprobación contra el tamaño del archivo
+		static uint64_t checked_add(uint64_t a, uint64_t b) {
+		    if (a > UINT64_MAX - b) {
+		        throw std::overflow_error("Las secciones del snapshot no caben en 64 bits.");
+		    }
+		    return a + b;
+		}
+		
+		static uint64_t checked_mul(uint64_t a, uint64_t b) {
+		    if (b != 0 && a > UINT64_MAX / b) {
+		        throw std::overflow_error("Las secciones del snapshot no caben en 64 bits.");
+		    }
+		    return a * b;
+		}
+		
+		static uint64_t align8(uint64_t offset) {
+		    return checked_add(offset, 7) & ~uint64_t(7);
+		}
+		
+		// Desplazamientos de las secciones. toy_count debe ser no negativo
+		static SnapshotLayout snapshot_layout(const SnapshotHeader &header) {
+		    uint64_t toys = static_cast<uint64_t>(header.toy_count);
+		    SnapshotLayout layout;
+		    layout.slots = align8(sizeof(SnapshotHeader));
+		    layout.table = align8(checked_add(layout.slots, checked_mul(header.slot_count, sizeof(int32_t))));
+		    layout.ids = align8(checked_add(layout.table,
+		                                    checked_mul(header.table_capacity, IdIndex<ToyRecord>::entry_bytes())));
+		    layout.name_index = align8(checked_add(layout.ids, checked_mul(toys, sizeof(int32_t))));
+		    layout.name_offsets = align8(checked_add(layout.name_index, checked_mul(toys, sizeof(NameEntry))));
+		    layout.name_chars = checked_add(layout.name_offsets,
+		                                    checked_mul(checked_add(header.name_count, 1), sizeof(uint64_t)));
+		    layout.end = checked_add(layout.name_chars, header.name_bytes);
+		    return layout;
+		}
+		
+		// Hash de un ID y un valor asociado (0 si no hay), para comparar conjuntos con sumas al cargar un snapshot
+		static uint64_t snapshot_hash(int id, uint64_t value) {
+		    uint64_t h = (static_cast<uint64_t>(static_cast<uint32_t>(id)) << 32) ^ value;
+		    h ^= h >> 30;
+		    h *= 0xBF58476D1CE4E5B9ULL;
+		    h ^= h >> 27;
+		    h *= 0x94D049BB133111EBULL;
+		    h ^= h >> 31;
+		    return h;
+		}
+		
+		// Índice actual (en slot_ids) de un juguete a partir de su posición almacenada
+		int index_of(int position) const {
+		    return position + front_shift;
+		}
+		
+		// Función helper para conocer el último elemento de la base de datos que no es un placeholder
+		int get_last_item_index() {
+		    return last_item;
+		}
+		
+		// Recalcula el último elemento hacia atrás desde "from" (solo se usa cuando el último elemento se mueve)
+		void update_last_item_from(int from) {
+		    last_item = static_cast<int>(occupied.find_last_set(from));
+		}
+		
+		// Lleva el juguete x a la casilla inferior de y, agregando una estantería si y está en la última
+		void relocate(ToyRecord *x_rec, ToyRecord *y_rec) {
+		    int x_idx = index_of(x_rec->position);
+		    int y_idx = index_of(y_rec->position);
+		    
+			// Crea una estantería si es necesario (en el caso de que el elemento de referencia se encuentre en la última estantería)
+		    if ((y_idx + capacity_per_stand) >= (capacity_per_stand * stands)) {
+		        stands++;
+		        slot_ids.append(capacity_per_stand, EMPTY_SLOT);
+		        occupied.append_free(capacity_per_stand);
+		    }
+		    
+		    int target = y_idx + capacity_per_stand;
+		    if (occupied.test(target)) {
+		        records.find(slot_ids[target])->position = x_idx - front_shift;
+		    }
+		    x_rec->position = target - front_shift;
+		    std::swap(slot_ids[x_idx], slot_ids[target]);
+		    occupied.set(x_idx, occupied.test(target));
+		    occupied.set(target, true);
+		    
+		    // Mantener el índice del último elemento sin recorrer toda la estantería
+		    if (target > last_item) {
+		        last_item = target;
+		    } else if (x_idx == last_item && !occupied.test(x_idx)) {
+		        update_last_item_from(x_idx);
+		    }
+		    
+		    if (auto_compact_ratio > 0 && stands >= next_compact_check) {
+		        auto_compact();
+		    }
+		}
+		
+		// Compacta si la proporción de estanterías vacías supera el umbral y programa la siguiente revisión
+		void auto_compact() {
+		    int empty_stands = 0;
+		    for (int k = 0; k < stands; k++) {
+		        if (toys_in_stand(k) == 0) { empty_stands++; }
+		    }
+		    if (empty_stands > auto_compact_ratio * stands) {
+		        compact();
+		    }
+		    next_compact_check = std::max(2 * stands, MIN_COMPACT_CHECK);
+		}
+		
+		// Mezcla IDs ya ordenados con "ids"
+		void merge_sorted_ids(const std::vector<int> &sorted) {
+		    size_t middle = ids.size();
+		    ids.insert(ids.end(), sorted.begin(), sorted.end());
+		    std::inplace_merge(ids.begin(), ids.begin() + middle, ids.end());
+		}
+		
+		// Ordena los IDs pendientes y los mezcla con "ids"
+		void merge_pending_ids() {
+		    if (!pending_ids.empty()) {
+		        std::sort(pending_ids.begin(), pending_ids.end());
+		        merge_sorted_ids(pending_ids);
+		        pending_ids.clear();
+		    }
+		}
+		
+		// Orden del índice de nombres: por nombre y, a igual nombre, por ID
+		bool name_less(const NameEntry &a, const NameEntry &b) const {
+		    if (a.name == b.name) {
+		        return a.id < b.id;
+		    }
+		    return names.get(a.name) < names.get(b.name); // Handles distintos siempre son cadenas distintas
+		}
+		
+		// Ordena los nombres pendientes y los mezcla con el índice de nombres
+		void merge_pending_names() {
+		    if (pending_names.empty()) {
+		        return;
+		    }
+		    auto less = [this](const NameEntry &a, const NameEntry &b) { return name_less(a, b); };
+		    std::sort(pending_names.begin(), pending_names.end(), less);
+		    size_t middle = name_index.size();
+		    name_index.insert(name_index.end(), pending_names.begin(), pending_names.end());
+		    std::inplace_merge(name_index.begin(), name_index.begin() + middle, name_index.end(), less);
+		    pending_names.clear();
+		}
+		
+		// Nombre de la casilla i ("**" para los placeholders)
+		std::string_view name_at(int i) const {
+		    int id = slot_ids[i];
+		    return (id == EMPTY_SLOT) ? std::string_view("**") : names.get(records.find(id)->name);
+		}
+		
+	public:
+		// Constructor ("create_shelf()") que se inicializa teniendo en cuenta la capacidad de cada estantería 
+		ToyShelf(int capacity_per_stand) : capacity_per_stand(capacity_per_stand) { }
+		
+		// Constructor que carga un catálogo completo con bulk_load
+		template<class Toys>
+		ToyShelf(int capacity_per_stand, const Toys &toys) : ToyShelf(capacity_per_stand) {
+		    bulk_load(toys);
+		}
+
+		// Inserta un nuevo juguete en la base de datos
+		void add_toy(int id, const std::string &name) {
+		    if (id == EMPTY_SLOT) {
+		        throw std::invalid_argument("El ID -1 está reservado para los placeholders.");
+		    }
+		    if (records.find(id) != nullptr) {
+		        throw std::invalid_argument("Ya existe un juguete con el ID " + std::to_string(id) + ".");
+		    }
+		    
+		    if (verbose) {
+		        std::cout << "Adding " << name << "(ID: " << id << ") to the shelf..." << '\n';
+		    }
+		    
+		    int last = get_last_item_index();
+		    
+			// Se tiene en cuenta el último elemento válido para saber si es necesario crear placeholders o removerlos
+			if ((last + 1) % capacity_per_stand == 0) {
+				slot_ids.push_front(id);
+				occupied.push_front(true);
+				stands++;
+				
+		        slot_ids.append(capacity_per_stand - 1, EMPTY_SLOT); // Creacion de placeholders
+		        occupied.append_free(capacity_per_stand - 1);
+			
+			} else {
+			    slot_ids.pop_back();
+			    occupied.pop_back();
+				slot_ids.push_front(id);
+				occupied.push_front(true);
+			}
+			toy_count++;
+			
+			// Todos los elementos se desplazan una posición, incluido el último
+			last_item = last + 1;
+			front_shift++;
+			uint32_t handle = names.intern(name);
+			records.insert(id, ToyRecord{-front_shift, handle});
+			
+			// Se almacenan los IDs para no tener que iterar para limpiar los placeholders
+			pending_ids.push_back(id);
+			pending_names.push_back(NameEntry{handle, id});
+			
+		}
+		
+		// Carga un catálogo ("toys" es cualquier rango de Toy). La estantería queda idéntica a la que dejarían
+		// llamadas sucesivas a add_toy en el mismo orden, pero se construye en una sola pasada y sin imprimir nada:
+		// los juguetes nuevos quedan al frente en orden inverso, seguidos de la estantería anterior y de los placeholders.
+		template<class Toys>
+		void bulk_load(const Toys &toys) {
+		    std::vector<int> batch_ids;
+		    for (const Toy &toy : toys) {
+		        if (toy.id == EMPTY_SLOT) {
+		            throw std::invalid_argument("El ID -1 está reservado para los placeholders.");
+		        }
+		        if (toy_count > 0 && records.find(toy.id) != nullptr) {
+		            throw std::invalid_argument("Ya existe un juguete con el ID " + std::to_string(toy.id) + ".");
+		        }
+		        batch_ids.push_back(toy.id);
+		    }
+		    
+		    // Los IDs ordenados sirven para detectar duplicados dentro del catálogo y para mezclarlos con la vista ordenada
+		    std::vector<int> sorted_ids = batch_ids;
+		    if (!std::is_sorted(sorted_ids.begin(), sorted_ids.end())) {
+		        std::sort(sorted_ids.begin(), sorted_ids.end());
+		    }
+		    auto duplicate = std::adjacent_find(sorted_ids.begin(), sorted_ids.end());
+		    if (duplicate != sorted_ids.end()) {
+		        throw std::invalid_argument("Ya existe un juguete con el ID " + std::to_string(*duplicate) + ".");
+		    }
+		    
+		    size_t n = batch_ids.size();
+		    
+		    // add_toy crea una estantería cada vez que (último + 1) es múltiplo de la capacidad. Como el último elemento
+		    // avanza una posición por juguete, basta contar los múltiplos de la capacidad en [último + 1, último + 1 + n)
+		    long long first = last_item + 1;
+		    long long cap = capacity_per_stand;
+		    long long new_stands = (first + static_cast<long long>(n) + cap - 1) / cap - (first + cap - 1) / cap;
+		    size_t final_size = slot_ids.size() + new_stands * cap;
+		    
+		    // Juguetes nuevos al frente (el último del catálogo queda primero) y placeholders ajustados al final
+		    std::vector<int> front(batch_ids.rbegin(), batch_ids.rend());
+		    slot_ids.prepend(front.data(), n);
+		    slot_ids.resize(final_size, EMPTY_SLOT);
+		    occupied.prepend_set(n);
+		    occupied.resize_free(final_size);
+		    
+		    records.reserve(records.size() + n);
+		    pending_names.reserve(pending_names.size() + n);
+		    // Se adelanta la carga de las casillas del índice unos juguetes antes para no esperar a la memoria en cada inserción
+		    const size_t LOOKAHEAD = 16;
+		    int position = -front_shift;
+		    size_t k = 0;
+		    for (const Toy &toy : toys) {
+		        if (k + LOOKAHEAD < n) {
+		            records.prefetch(batch_ids[k + LOOKAHEAD]);
+		        }
+		        uint32_t handle = names.intern(toy.name);
+		        records.insert(toy.id, ToyRecord{--position, handle});
+		        pending_names.push_back(NameEntry{handle, toy.id});
+		        k++;
+		    }
+		    
+		    front_shift += static_cast<int>(n);
+		    stands += static_cast<int>(new_stands);
+		    last_item += static_cast<int>(n);
+		    toy_count += static_cast<int>(n);
+		    
+		    merge_pending_ids();
+		    merge_sorted_ids(sorted_ids);
+		}
+		
+		// Devuelve los IDs ordenados sin copiarlos. Solo se ordenan los IDs nuevos y se mezclan con los que ya estaban ordenados
+		IdView view_shelf(bool rev=false) {
+		    merge_pending_ids();
+		    return IdView(ids.data(), ids.data() + ids.size(), rev);
+		}
+		
+		// Devuelve, sin copiarlos, los IDs en [low, high] ordenados (descendente si rev). O(log N + k) con dos búsquedas binarias
+		IdView ids_in_range(int low, int high, bool rev=false) {
+		    merge_pending_ids();
+		    if (low > high) {
+		        return IdView(ids.data(), ids.data(), rev);
+		    }
+		    const int *begin = ids.data();
+		    const int *end = ids.data() + ids.size();
+		    const int *first = std::lower_bound(begin, end, low);
+		    const int *last = std::upper_bound(first, end, high);
+		    return IdView(first, last, rev);
+		}
+		
+		// Devuelve los IDs de los juguetes cuyo nombre empieza por "prefix", ordenados por nombre y luego por ID.
+		// Los nombres con el mismo prefijo quedan contiguos en el índice, así que basta una búsqueda binaria y recorrer k entradas
+		std::vector<int> find_by_name_prefix(std::string_view prefix) {
+		    merge_pending_names();
+		    auto first = std::lower_bound(name_index.begin(), name_index.end(), prefix,
+		        [this](const NameEntry &entry, std::string_view key) { return names.get(entry.name) < key; });
+		    
+		    std::vector<int> found;
+		    for (auto it = first; it != name_index.end(); ++it) {
+		        std::string_view name = names.get(it->name);
+		        if (name.compare(0, prefix.size(), prefix) != 0) {
+		            break;
+		        }
+		        found.push_back(it->id);
+		    }
+		    return found;
+		}
+		
+		// Estantería y casilla donde está un juguete. O(1): la posición se mantiene al agregar, mover y compactar
+		SlotLocation locate(int id) const {
+		    const ToyRecord *rec = records.find(id);
+		    if (rec == nullptr) {
+		        throw std::out_of_range("No existe un juguete con el ID " + std::to_string(id) + ".");
+		    }
+		    int index = index_of(rec->position);
+		    return SlotLocation{index / capacity_per_stand, index % capacity_per_stand};
+		}
+		
+		// Mueve un elemento de la estantería a la ubicación inferior de otro elemento. Devuelve false si alguno de los
+		// dos IDs no existe
+		bool move_below(int x, int y) {
+		    ToyRecord *x_rec = records.find(x);
+		    ToyRecord *y_rec = records.find(y);
+            
+            if ((x_rec == nullptr) || (y_rec == nullptr)) {
+                return false;
+            }
+            if (verbose) {
+                std::cout << "Moving " << names.get(x_rec->name) << " (ID: " << x << ") below " << names.get(y_rec->name) << " (ID: " << y << ")" << std::endl;
+            }
+            relocate(x_rec, y_rec);
+            return true;
+		}
+		
+		// Aplica un lote de movimientos ("moves" es cualquier rango de std::pair<int, int> con {x, y}).
+		// El resultado es el mismo que llamar move_below(x, y) en orden, pero los IDs se resuelven en una sola pasada
+		// y no se imprime nada por cada movimiento. Las estanterías nuevas crecen como en move_below (O(1) amortizado):
+		// reservar el peor caso (una estantería por movimiento) costaría memoria aunque no se agregue ninguna.
+		template<class Moves>
+		MoveBatchResult apply_moves(const Moves &moves) {
+		    MoveBatchResult result;
+		    
+		    // Primera pasada: resolver los IDs. Los juguetes nunca salen de la estantería,
+		    // así que un ID que no existe ahora tampoco existirá durante el lote
+		    std::vector<std::pair<ToyRecord *, ToyRecord *>> resolved;
+		    size_t index = 0;
+		    for (const auto &move : moves) {
+		        ToyRecord *x_rec = records.find(move.first);
+		        ToyRecord *y_rec = records.find(move.second);
+		        if ((x_rec != nullptr) && (y_rec != nullptr)) {
+		            resolved.emplace_back(x_rec, y_rec);
+		        } else {
+		            resolved.emplace_back(nullptr, nullptr);
+		            result.failed.push_back(index);
+		        }
+		        index++;
+		    }
+		    
+		    // Segunda pasada: aplicar los intercambios en orden
+		    for (const auto &move : resolved) {
+		        if (move.first != nullptr) {
+		            relocate(move.first, move.second);
+		            result.applied++;
+		        }
+		    }
+		    return result;
+		}
+
+		// Elimina las estanterías vacías y libera la memoria sobrante. Las estanterías que quedan conservan su orden y cada
+		// juguete su columna, así que todo juguete que estaba justo debajo de otro lo sigue estando. Lo inverso no vale:
+		// al quitar una estantería vacía intermedia, los juguetes de la estantería siguiente quedan justo debajo de los de
+		// la anterior, con los que antes no eran vecinos
+		CompactionStats compact() {
+		    CompactionStats stats;
+		    size_t bytes_before = layout_bytes();
+		    
+		    // Se recorren las estanterías moviendo las no vacías hacia arriba (w <= k, así que se puede hacer en el mismo arreglo)
+		    int w = 0;
+		    for (int k = 0; k < stands; k++) {
+		        int from = k * capacity_per_stand;
+		        if (occupied.count(from, from + capacity_per_stand) == 0) {
+		            continue;
+		        }
+		        if (w != k) {
+		            int to = w * capacity_per_stand;
+		            for (int j = 0; j < capacity_per_stand; j++) {
+		                int id = slot_ids[from + j];
+		                bool is_toy = occupied.test(from + j);
+		                slot_ids[to + j] = id;
+		                occupied.set(to + j, is_toy);
+		                if (is_toy) {
+		                    records.find(id)->position = to + j - front_shift;
+		                }
+		            }
+		        }
+		        w++;
+		    }
+		    
+		    stats.stands_reclaimed = stands - w;
+		    stands = w;
+		    slot_ids.resize(stands * capacity_per_stand, EMPTY_SLOT);
+		    occupied.resize_free(stands * capacity_per_stand);
+		    slot_ids.shrink_to_fit();
+		    occupied.shrink_to_fit();
+		    update_last_item_from(static_cast<int>(slot_ids.size()) - 1);
+		    
+		    size_t bytes_after = layout_bytes();
+		    stats.bytes_reclaimed = bytes_before > bytes_after ? bytes_before - bytes_after : 0;
+		    return stats;
+		}
+		
+		// Activa la compactación automática cuando más de "max_empty_ratio" de las estanterías quedan vacías (0 la desactiva)
+		void set_auto_compact(double max_empty_ratio) {
+		    auto_compact_ratio = max_empty_ratio;
+		    next_compact_check = std::max(2 * stands, MIN_COMPACT_CHECK);
+		}
+		
+		// Activa o desactiva los mensajes de add_toy y move_below (para usarlas una a una sin imprimir, p. ej. en benchmarks)
+		void set_verbose(bool enabled) {
+		    verbose = enabled;
+		}
+		
+		// Memoria reservada por la disposición de casillas (IDs por casilla y mapa de ocupación)
+		size_t layout_bytes() const {
+		    return slot_ids.capacity_bytes() + occupied.capacity_bytes();
+		}
+		
+		// Guarda el estado completo en un archivo binario versionado (ver SnapshotHeader). No guarda la configuración
+		// de compactación automática. No es const porque antes mezcla los IDs y nombres pendientes en sus índices
+		void save(const std::string &path) {
+		    merge_pending_ids();
+		    merge_pending_names();
+		    
+		    SnapshotHeader header = {};
+		    std::memcpy(header.magic, "TOYSHELF", 8);
+		    header.version = SNAPSHOT_VERSION;
+		    header.byte_order = SNAPSHOT_BYTE_ORDER;
+		    header.capacity_per_stand = capacity_per_stand;
+		    header.stands = stands;
+		    header.last_item = last_item;
+		    header.toy_count = toy_count;
+		    header.front_shift = front_shift;
+		    header.slot_count = slot_ids.size();
+		    header.table_capacity = records.capacity();
+		    header.name_count = names.size();
+		    
+		    std::vector<uint64_t> name_offsets(1, 0);
+		    for (uint32_t h = 0; h < names.size(); h++) {
+		        name_offsets.push_back(name_offsets.back() + names.get(h).size());
+		    }
+		    header.name_bytes = name_offsets.back();
+		    SnapshotLayout layout = snapshot_layout(header);
+		    
+		    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		    if (!out) {
+		        throw std::runtime_error("No se pudo crear " + path + ".");
+		    }
+		    uint64_t written = 0;
+		    auto write_at = [&](uint64_t offset, const void *data, size_t bytes) {
+		        static const char zeros[8] = {};
+		        out.write(zeros, static_cast<std::streamsize>(offset - written)); // Relleno de alineación
+		        out.write(static_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+		        written = offset + bytes;
+		    };
+		    write_at(0, &header, sizeof(header));
+		    write_at(layout.slots, slot_ids.data(), slot_ids.size() * sizeof(int32_t));
+		    write_at(layout.table, records.table_data(), records.table_bytes());
+		    write_at(layout.ids, ids.data(), ids.size() * sizeof(int32_t));
+		    write_at(layout.name_index, name_index.data(), name_index.size() * sizeof(NameEntry));
+		    write_at(layout.name_offsets, name_offsets.data(), name_offsets.size() * sizeof(uint64_t));
+		    for (uint32_t h = 0; h < names.size(); h++) {
+		        std::string_view name = names.get(h);
+		        write_at(written, name.data(), name.size());
+		    }
+		    out.flush();
+		    if (!out) {
+		        throw std::runtime_error("No se pudo escribir " + path + ".");
+		    }
+		}
+		
+		// Carga una estantería guardada con save. El archivo se proyecta en memoria y las secciones se copian tal cual
+		// (incluida la tabla hash, que no se reconstruye); solo se rehacen el mapa de ocupación y el diccionario de nombres.
+		// Antes de usar la estantería se comprueba que todas las secciones sean coherentes entre sí, así que un archivo
+		// dañado lanza una excepción en lugar de dejar posiciones o handles fuera de rango
+		static ToyShelf load(const std::string &path) {
+		    MappedFile file(path);
+		    SnapshotHeader header;
+		    if (file.size() < sizeof(header)) {
+		        throw std::runtime_error(path + " no es un snapshot de ToyShelf.");
+		    }
+		    std::memcpy(&header, file.data(), sizeof(header));
+		    if (std::memcmp(header.magic, "TOYSHELF", 8) != 0) {
+		        throw std::runtime_error(path + " no es un snapshot de ToyShelf.");
+		    }
+		    if (header.version != SNAPSHOT_VERSION || header.byte_order != SNAPSHOT_BYTE_ORDER) {
+		        throw std::runtime_error(path + " tiene una versión o arquitectura no soportada.");
+		    }
+		    
+		    // Cabecera: se valida antes de construir la estantería y de calcular el layout
+		    const std::runtime_error damaged(path + " está incompleto o dañado.");
+		    if (header.capacity_per_stand <= 0 || header.stands < 0 || header.toy_count < 0 || header.front_shift < 0 ||
+		        header.last_item < -1 ||
+		        header.slot_count != static_cast<uint64_t>(header.stands) * header.capacity_per_stand ||
+		        header.slot_count > static_cast<uint64_t>(INT32_MAX) ||
+		        header.last_item >= static_cast<int64_t>(header.slot_count) ||
+		        header.name_count > UINT32_MAX) {
+		        throw damaged;
+		    }
+		    SnapshotLayout layout;
+		    try {
+		        layout = snapshot_layout(header);
+		    } catch (const std::overflow_error &) {
+		        throw damaged;
+		    }
+		    if (layout.end > file.size()) {
+		        throw damaged;
+		    }
+		    const unsigned char *base = file.data();
+		    
+		    ToyShelf shelf(header.capacity_per_stand);
+		    shelf.stands = header.stands;
+		    shelf.last_item = header.last_item;
+		    shelf.toy_count = header.toy_count;
+		    shelf.front_shift = header.front_shift;
+		    
+		    const uint64_t *offsets = reinterpret_cast<const uint64_t *>(base + layout.name_offsets);
+		    const char *chars = reinterpret_cast<const char *>(base + layout.name_chars);
+		    for (uint64_t h = 0; h < header.name_count; h++) {
+		        if (offsets[h] > offsets[h + 1] || offsets[h + 1] > header.name_bytes ||
+		            shelf.names.intern(std::string_view(chars + offsets[h], offsets[h + 1] - offsets[h])) != h) {
+		            throw std::runtime_error(path + " tiene una tabla de nombres dañada.");
+		        }
+		    }
+		    
+		    const std::runtime_error bad_index(path + " tiene un índice de juguetes dañado.");
+		    try {
+		        shelf.records.assign_table(base + layout.table, header.table_capacity);
+		    } catch (const std::invalid_argument &) {
+		        throw bad_index;
+		    }
+		    if (shelf.records.size() != static_cast<size_t>(header.toy_count)) {
+		        throw bad_index;
+		    }
+		    
+		    // Una sola pasada por la tabla valida cada registro y arma el mapa de ocupación: el registro apunta a una
+		    // casilla dentro de la estantería que tiene su ID, a la que no apunta ningún otro, y su nombre existe.
+		    // De paso suma un hash de cada ID y de cada par (ID, nombre) para comparar con los índices ordenados sin
+		    // volver a buscar en la tabla
+		    const int *slots = reinterpret_cast<const int *>(base + layout.slots);
+		    shelf.slot_ids.prepend(slots, header.slot_count);
+		    shelf.occupied.resize_free(header.slot_count);
+		    const int64_t slot_count = static_cast<int64_t>(header.slot_count);
+		    uint64_t id_sum = 0;
+		    uint64_t pair_sum = 0;
+		    bool records_ok = shelf.records.check_entries([&](int id, const ToyRecord &rec) {
+		        int64_t index = static_cast<int64_t>(rec.position) + header.front_shift;
+		        if (index < 0 || index >= slot_count || slots[index] != id || rec.name >= header.name_count ||
+		            shelf.occupied.test(index)) {
+		            return false;
+		        }
+		        shelf.occupied.set(index, true);
+		        id_sum += snapshot_hash(id, 0);
+		        pair_sum += snapshot_hash(id, rec.name + uint64_t(1));
+		        return true;
+		    });
+		    // Hay toy_count casillas marcadas con su ID; si además hay toy_count casillas no vacías, son las mismas
+		    int64_t toys_in_slots = slot_count - std::count(slots, slots + slot_count, EMPTY_SLOT);
+		    if (!records_ok || toys_in_slots != header.toy_count ||
+		        shelf.occupied.find_last_set(slot_count - 1) != header.last_item) {
+		        throw bad_index;
+		    }
+		    
+		    // IDs ordenados e índice de nombres, en una pasada secuencial: orden estricto, handles dentro del diccionario y las mismas
+		    // sumas que los registros. Como no hay repetidos y hay toy_count de cada uno, sumas iguales significan los
+		    // mismos IDs y los mismos pares (salvo una coincidencia de hashes de 64 bits)
+		    const int *sorted = reinterpret_cast<const int *>(base + layout.ids);
+		    const NameEntry *entries = reinterpret_cast<const NameEntry *>(base + layout.name_index);
+		    const std::runtime_error bad_names(path + " tiene un índice de nombres dañado.");
+		    for (int i = 0; i < header.toy_count; i++) {
+		        if (i > 0 && sorted[i - 1] >= sorted[i]) {
+		            throw bad_index;
+		        }
+		        if (entries[i].name >= header.name_count || (i > 0 && !shelf.name_less(entries[i - 1], entries[i]))) {
+		            throw bad_names;
+		        }
+		        id_sum -= snapshot_hash(sorted[i], 0);
+		        pair_sum -= snapshot_hash(entries[i].id, entries[i].name + uint64_t(1));
+		    }
+		    if (id_sum != 0) {
+		        throw bad_index;
+		    }
+		    if (pair_sum != 0) {
+		        throw bad_names;
+		    }
+		    shelf.ids.assign(sorted, sorted + header.toy_count);
+		    shelf.name_index.assign(entries, entries + header.toy_count);
+		    return shelf;
+		}
+		
+		// Número de estanterías
+		int stand_count() const {
+		    return stands;
+		}
+		
+		// Número de juguetes en la estantería "stand" (0 es la superior)
+		int toys_in_stand(int stand) const {
+		    return static_cast<int>(occupied.count(stand * capacity_per_stand, (stand + 1) * capacity_per_stand));
+		}
+		
+		// Número total de juguetes en la estantería
+		int size() const {
+		    return toy_count;
+		}
+		
+		// Imprime la estantería para mantener visibilidad
+		void print() {
+			for (int i = 0; i < static_cast<int>(slot_ids.size()); i++) {
+			    
+				if (i % capacity_per_stand == 0) {
+				    std::cout << std::endl;
+				    std::cout << std::string(12*capacity_per_stand, '-') << std::endl;
+				}
+				
+				std::cout << std::setfill(' ') << std::setw(12);
+				std::cout << name_at(i);
+			}
+			std::cout << std::endl;
+			std::cout << std::string(12*capacity_per_stand, '-') << std::endl;
+			std::cout << "Stands: " << stands <<std::endl;
+			std::cout << std::endl;
+		}
+};
+
+#endif // TOY_SHELF_H
@@ -0,0 +1,149 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include "blocking_queue.h"
+
+// Pipeline de un productor y un consumidor unidos por BlockingQueue. Cada elemento lleva el instante en que se creó y
+// el consumidor mide la latencia (creación -> salida de la cola).
+//  - batch: con BackPressure::Block, el productor agrega lotes de B elementos con enqueue_bulk y el consumidor quita
+//    hasta B con dequeue_bulk (B = 1 equivale a enqueue/dequeue de a uno). Muestra elementos por segundo y los
+//    percentiles 50, 99 y 99.9 de la latencia.
+//  - policy: el consumidor es más lento que el productor (--work iteraciones por elemento) y se comparan las tres
+//    políticas de contrapresión con lotes de 64: elementos entregados, descartados y latencia.
+//
+// Uso: ./benchmark_blocking_queue [--items N] [--capacity C] [--work W]
+
+using Clock = std::chrono::steady_clock;
+
+struct Item {
+    Clock::time_point created;
+    long long value;
+};
+
+static volatile long long sink;
+
+struct Result {
+    double seconds;
+    long long delivered;
+    long long dropped;
+    std::vector<double> latencies_us;   // Ordenadas
+};
+
+static Result run(long long items, size_t capacity, size_t batch, BackPressure policy, int work) {
+    BlockingQueue<Item> queue(capacity, policy);
+    Result result{};
+    result.latencies_us.reserve(items);
+
+    auto start = Clock::now();
+    std::thread producer([&] {
+        std::vector<Item> buffer(batch);
+        for (long long sent = 0; sent < items; sent += static_cast<long long>(batch)) {
+            size_t count = static_cast<size_t>(std::min<long long>(batch, items - sent));
+            Clock::time_point now = Clock::now();
+            for (size_t i = 0; i < count; i++) {
+                buffer[i] = Item{now, sent + static_cast<long long>(i)};
+            }
+            queue.enqueue_bulk(buffer.begin(), buffer.begin() + count);
+        }
+        queue.close();
+    });
+
+    std::vector<Item> received;
+    received.reserve(batch);
+    long long total = 0;
+    while (true) {
+        received.clear();
+        if (queue.dequeue_bulk(std::back_inserter(received), batch) == 0) {
+            break;
+        }
+        Clock::time_point now = Clock::now();
+        for (const Item &item : received) {
+            result.latencies_us.push_back(std::chrono::duration<double, std::micro>(now - item.created).count());
+            long long x = item.value;
+            for (int w = 0; w < work; w++) {
+                x = x * 6364136223846793005LL + 1442695040888963407LL;
+            }
+            total += x;
+        }
+    }
+    producer.join();
+    sink = total;
+
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    result.delivered = static_cast<long long>(result.latencies_us.size());
+    result.dropped = queue.dropped();
+    std::sort(result.latencies_us.begin(), result.latencies_us.end());
+    return result;
+}
+
+static double percentile(const std::vector<double> &sorted, double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t i = static_cast<size_t>(p / 100.0 * (sorted.size() - 1));
+    return sorted[i];
+}
+
+static void print_latencies(const Result &result) {
+    std::cout << std::setw(12) << percentile(result.latencies_us, 50) << std::setw(12)
+              << percentile(result.latencies_us, 99) << std::setw(12) << percentile(result.latencies_us, 99.9);
+}
+
+int main(int argc, char *argv[]) {
+    long long items = 2000000;
+    size_t capacity = 4096;
+    int work = 200;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--items") {
+            items = std::stoll(argv[++i]);
+        } else if (arg == "--capacity") {
+            capacity = std::stoull(argv[++i]);
+        } else if (arg == "--work") {
+            work = std::stoi(argv[++i]);
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Batch size (" << items << " items, capacity " << capacity << ", BackPressure::Block)" << std::endl;
+    std::cout << std::setw(8) << "batch" << std::setw(14) << "Mitems/s" << std::setw(12) << "p50 us"
+              << std::setw(12) << "p99 us" << std::setw(12) << "p99.9 us" << std::endl;
+    bool all_delivered = true;
+    for (size_t batch : {1, 4, 16, 64, 256, 1024}) {
+        Result result = run(items, capacity, batch, BackPressure::Block, 0);
+        all_delivered = all_delivered && result.delivered == items;
+        std::cout << std::setw(8) << batch << std::setw(14) << result.delivered / result.seconds / 1e6;
+        print_latencies(result);
+        std::cout << std::endl;
+    }
+
+    long long slow_items = items / 10;
+    std::cout << std::endl << "Back-pressure policy (" << slow_items << " items, batch 64, slow consumer: " << work
+              << " iterations per item)" << std::endl;
+    std::cout << std::setw(12) << "policy" << std::setw(12) << "delivered" << std::setw(12) << "dropped"
+              << std::setw(12) << "p50 us" << std::setw(12) << "p99 us" << std::setw(12) << "p99.9 us" << std::endl;
+    const std::pair<const char *, BackPressure> policies[] = {
+        {"Block", BackPressure::Block}, {"DropNewest", BackPressure::DropNewest}, {"DropOldest", BackPressure::DropOldest}};
+    for (const auto &policy : policies) {
+        Result result = run(slow_items, capacity, 64, policy.second, work);
+        all_delivered = all_delivered && result.delivered + result.dropped == slow_items;
+        std::cout << std::setw(12) << policy.first << std::setw(12) << result.delivered << std::setw(12)
+                  << result.dropped;
+        print_latencies(result);
+        std::cout << std::endl;
+    }
+
+    return all_delivered ? 0 : 1;
+}
@@ -0,0 +1,222 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <list>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "classifier.h"
+#include "macro_step.h"
+
+// Compara el motor de binary_classifier (Queue<char>, un byte por bit) con BitQueue en dos pruebas:
+//  - steps: aplica --steps pasos de la regla sobre entradas aleatorias de hasta --max-bits bits, con Queue<char, std::list>
+//    (el contenedor original), Queue<char> (RingBuffer) y BitQueue. Verifica que los tres lleguen al mismo estado.
+//  - classify: clasifica todas las cadenas de --length bits con binary_classifier (sin imprimir) y con
+//    binary_classifier_fast, y verifica que las clasificaciones coincidan.
+//  - long runs: clasifica entradas (100)^n que tardan millones de pasos en entrar en un ciclo, con binary_classifier
+//    y con binary_classifier_fast en sus dos modos de detección de bucles (tabla de huellas y Brent).
+//  - macro steps: aplica --steps pasos a las mismas entradas (100)^n de a un paso (apply_tag_rule), en bloques de 21
+//    pasos (advance_tag_rule) y con tablas de macro-pasos de k = 12, 16 y 20 bits. Verifica que lleguen al mismo estado.
+//
+// Uso: ./benchmark_classifier [--steps S] [--max-bits B] [--length N]
+
+template<class Q>
+void queue_step(Q &q) {
+    char front = q.front();
+    q.dequeue();
+    q.dequeue();
+    q.dequeue();
+    if (front == '0') {
+        q.enqueue('0');
+        q.enqueue('0');
+    } else {
+        q.enqueue('1');
+        q.enqueue('1');
+        q.enqueue('0');
+        q.enqueue('1');
+    }
+}
+
+template<class Q>
+std::string queue_to_string(Q &q) {
+    std::string bin;
+    while (!q.empty()) {
+        bin += q.dequeue();
+    }
+    return bin;
+}
+
+static double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<class Q>
+double run_queue(const std::string &input, long long steps, std::string &final_state) {
+    Q q;
+    for (char c : input) {
+        q.enqueue(c);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (long long s = 0; s < steps && q.size() >= 3; s++) {
+        queue_step(q);
+    }
+    double seconds = seconds_since(start);
+    final_state = queue_to_string(q);
+    return seconds;
+}
+
+int main(int argc, char *argv[]) {
+    long long steps = 5000000;
+    long long max_bits = 4000000;
+    int length = 14;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--steps") {
+            steps = std::stoll(argv[++i]);
+        } else if (arg == "--max-bits") {
+            max_bits = std::stoll(argv[++i]);
+        } else if (arg == "--length") {
+            length = std::stoi(argv[++i]);
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Steps per second (" << steps << " steps per input)" << std::endl;
+    std::cout << std::setw(10) << "bits" << std::setw(16) << "list Msteps/s" << std::setw(16) << "ring Msteps/s"
+              << std::setw(16) << "bits Msteps/s" << std::setw(10) << "match" << std::endl;
+
+    std::mt19937 rng(11);
+    bool all_match = true;
+    for (long long bits = 1000; bits <= max_bits; bits *= 10) {
+        std::string input(bits, '0');
+        for (char &c : input) {
+            c = (rng() & 1) ? '1' : '0';
+        }
+
+        std::string list_state, ring_state;
+        double list_seconds = run_queue<Queue<char, std::list>>(input, steps, list_state);
+        double ring_seconds = run_queue<Queue<char>>(input, steps, ring_state);
+
+        BitQueue q(input);
+        auto start = std::chrono::steady_clock::now();
+        advance_tag_rule(q, steps);
+        double bit_seconds = seconds_since(start);
+
+        bool match = list_state == ring_state && ring_state == q.to_string();
+        all_match = all_match && match;
+        std::cout << std::setw(10) << bits << std::setw(16) << steps / list_seconds / 1e6
+                  << std::setw(16) << steps / ring_seconds / 1e6 << std::setw(16) << steps / bit_seconds / 1e6
+                  << std::setw(10) << (match ? "yes" : "NO") << std::endl;
+    }
+
+    std::cout << std::endl << "Classifying all " << (1LL << length) << " strings of " << length << " bits" << std::endl;
+    int loops = 0;
+    int mismatches = 0;
+    double original_seconds = 0;
+    double fast_seconds = 0;
+    for (long long m = 0; m < (1LL << length); m++) {
+        std::string bin(length, '0');
+        for (int k = 0; k < length; k++) {
+            if ((m >> k) & 1) {
+                bin[k] = '1';
+            }
+        }
+        auto start = std::chrono::steady_clock::now();
+        std::string original = binary_classifier(bin, false);
+        original_seconds += seconds_since(start);
+
+        start = std::chrono::steady_clock::now();
+        std::string fast = binary_classifier_fast(bin);
+        fast_seconds += seconds_since(start);
+
+        loops += (fast == "1101");
+        mismatches += (fast != original);
+    }
+    std::cout << "binary_classifier       " << original_seconds << " s" << std::endl;
+    std::cout << "binary_classifier_fast  " << fast_seconds << " s" << std::endl;
+    std::cout << "Loops: " << loops << ", mismatches: " << mismatches << std::endl;
+
+    // (100)^n con n = 24, 53, 72 y 102 entra en un ciclo después de unos 4.3M, 12.8M, 6.1M y 5.6M pasos
+    std::cout << std::endl << "Long runs" << std::endl;
+    std::cout << std::setw(10) << "input" << std::setw(12) << "class" << std::setw(16) << "classifier s"
+              << std::setw(16) << "fast hash s" << std::setw(16) << "fast Brent s" << std::endl;
+    for (int n : {24, 53, 72, 102}) {
+        std::string bin;
+        for (int i = 0; i < n; i++) {
+            bin += "100";
+        }
+        // binary_classifier guarda una huella por paso (millones de nodos); se mide al final para que liberar esa
+        // memoria no afecte a las otras mediciones
+        auto start = std::chrono::steady_clock::now();
+        std::string hashed = binary_classifier_fast(bin, LoopDetection::HashSet);
+        double hash_seconds = seconds_since(start);
+
+        start = std::chrono::steady_clock::now();
+        std::string brent = binary_classifier_fast(bin, LoopDetection::Brent);
+        double brent_seconds = seconds_since(start);
+
+        start = std::chrono::steady_clock::now();
+        std::string original = binary_classifier(bin, false);
+        original_seconds = seconds_since(start);
+
+        mismatches += (hashed != original) + (brent != original);
+        std::cout << std::setw(10) << ("(100)^" + std::to_string(n)) << std::setw(12) << original
+                  << std::setw(16) << original_seconds << std::setw(16) << hash_seconds
+                  << std::setw(16) << brent_seconds << std::endl;
+    }
+
+    std::cout << std::endl << "Macro steps (" << steps << " steps per input, Msteps/s)" << std::endl;
+    std::cout << std::setw(10) << "input" << std::setw(10) << "single" << std::setw(10) << "block21";
+    std::vector<MacroStepTable> tables;
+    for (int k : {12, 16, 20}) {
+        auto start = std::chrono::steady_clock::now();
+        tables.emplace_back(k);
+        std::cout << std::setw(8) << "k=" + std::to_string(k) << " (" << std::setw(5) << seconds_since(start) * 1e3
+                  << " ms)";
+    }
+    std::cout << std::setw(10) << "match" << std::endl;
+    for (int n : {24, 53, 72, 102}) {
+        std::string bin;
+        for (int i = 0; i < n; i++) {
+            bin += "100";
+        }
+
+        BitQueue single(bin);
+        auto start = std::chrono::steady_clock::now();
+        long long done = 0;
+        while (done < steps && single.size() >= 3) {
+            apply_tag_rule(single);
+            done++;
+        }
+        double single_seconds = seconds_since(start);
+
+        BitQueue block(bin);
+        start = std::chrono::steady_clock::now();
+        advance_tag_rule(block, steps);
+        double block_seconds = seconds_since(start);
+
+        std::cout << std::setw(10) << ("(100)^" + std::to_string(n)) << std::setw(10) << done / single_seconds / 1e6
+                  << std::setw(10) << done / block_seconds / 1e6;
+        bool match = block.to_string() == single.to_string();
+        for (const MacroStepTable &table : tables) {
+            BitQueue q(bin);
+            start = std::chrono::steady_clock::now();
+            long long macro_done = table.advance(q, steps);
+            double macro_seconds = seconds_since(start);
+            match = match && macro_done == done && q.to_string() == single.to_string();
+            std::cout << std::setw(20) << macro_done / macro_seconds / 1e6;
+        }
+        all_match = all_match && match;
+        std::cout << std::setw(10) << (match ? "yes" : "NO") << std::endl;
+    }
+
+    return (all_match && mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include "queue_list.h"
+#include "concurrent_queue.h"
+
+// Compara el paso de elementos entre hilos con Queue<long long> protegida por un mutex, MpmcQueue y SpscQueue.
+// Para cada cantidad de hilos P (1, 2, 4, 8, 16) hay P productores y P consumidores; cada productor agrega --items / P
+// valores y cada consumidor quita la misma cantidad. SpscQueue solo admite un productor y un consumidor (P = 1).
+// Se verifica que la suma de lo consumido sea la suma de lo producido.
+//
+// Uso: ./benchmark_concurrent_queue [--items N] [--capacity C]
+
+// Queue con un mutex: la forma de compartirla entre hilos antes de las colas concurrentes
+class LockedQueue {
+private:
+    Queue<long long> queue;
+    std::mutex mutex;
+    size_t capacity;
+
+public:
+    explicit LockedQueue(size_t capacity) : capacity(capacity) {}
+
+    void enqueue(long long value) {
+        for (int spins = 0; ; concurrent_detail::backoff(spins)) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (static_cast<size_t>(queue.size()) < capacity) {
+                queue.enqueue(value);
+                return;
+            }
+        }
+    }
+
+    long long dequeue() {
+        long long value;
+        for (int spins = 0; ; concurrent_detail::backoff(spins)) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (queue.try_dequeue(value)) {
+                return value;
+            }
+        }
+    }
+};
+
+template<class Q>
+double run(Q &queue, int pairs, long long items, bool &sum_ok) {
+    long long per_thread = items / pairs;
+    std::atomic<long long> consumed_sum{0};
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < pairs; p++) {
+        threads.emplace_back([&queue, p, per_thread] {
+            for (long long i = 0; i < per_thread; i++) {
+                queue.enqueue(p * per_thread + i);
+            }
+        });
+        threads.emplace_back([&queue, &consumed_sum, per_thread] {
+            long long sum = 0;
+            for (long long i = 0; i < per_thread; i++) {
+                sum += queue.dequeue();
+            }
+            consumed_sum += sum;
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    long long total = per_thread * pairs;
+    sum_ok = consumed_sum.load() == total * (total - 1) / 2;
+    return total / seconds / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+    long long items = 4000000;
+    size_t capacity = 1024;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--items") {
+            items = std::stoll(argv[++i]);
+        } else if (arg == "--capacity") {
+            capacity = std::stoull(argv[++i]);
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << ", capacity " << capacity << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(10) << "producers" << std::setw(10) << "consumers" << std::setw(16) << "mutex Mops/s"
+              << std::setw(16) << "mpmc Mops/s" << std::setw(16) << "spsc Mops/s" << std::setw(8) << "sums" << std::endl;
+
+    bool all_ok = true;
+    for (int pairs : {1, 2, 4, 8, 16}) {
+        bool locked_ok = false, mpmc_ok = false, spsc_ok = true;
+        LockedQueue locked(capacity);
+        double locked_mops = run(locked, pairs, items, locked_ok);
+        MpmcQueue<long long> mpmc(capacity);
+        double mpmc_mops = run(mpmc, pairs, items, mpmc_ok);
+
+        std::cout << std::setw(10) << pairs << std::setw(10) << pairs << std::setw(16) << locked_mops
+                  << std::setw(16) << mpmc_mops;
+        if (pairs == 1) {
+            SpscQueue<long long> spsc(capacity);
+            std::cout << std::setw(16) << run(spsc, 1, items, spsc_ok);
+        } else {
+            std::cout << std::setw(16) << "-";
+        }
+        bool ok = locked_ok && mpmc_ok && spsc_ok;
+        all_ok = all_ok && ok;
+        std::cout << std::setw(8) << (ok ? "ok" : "WRONG") << std::endl;
+    }
+
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,284 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <functional>
+#include <utility>
+#include <limits>
+#include "priority_queue.h"
+
+// Compara std::priority_queue con PriorityQueue de 2, 4 y 8 hijos por nodo (montículo de mínimos de long long).
+// Cada cantidad de operaciones (enqueue o dequeue) va de 1e6 hasta --max-ops (1e8 por defecto) multiplicando por 10:
+//  - fill/drain: ops / 2 enqueue de valores aleatorios y luego ops / 2 dequeue
+//  - steady: la cola mantiene --window elementos y cada paso hace un dequeue y un enqueue de un valor algo mayor
+//    (como la agenda de eventos de una simulación)
+//  - heapify: construye la cola desde un rango de ops / 2 valores (O(n)) y la vacía
+// Luego resuelve Dijkstra sobre un grafo aleatorio con std::priority_queue (reinsertando y descartando entradas
+// viejas) y con PriorityQueue::update (decrease-key), y verifica que las distancias coincidan.
+//
+// Con 1e8 cada cola llega a 5e7 elementos (400 MB, el doble en heapify) y la corrida completa tarda varios minutos;
+// --max-ops 10000000 da una pasada rápida.
+//
+// Uso: ./benchmark_priority_queue [--max-ops N] [--window W] [--nodes V] [--degree D]
+
+static volatile long long sink;
+
+using Value = long long;
+
+// Generador xorshift: barato para que no pese en la medición
+struct Random {
+    unsigned long long state = 88172645463325252ULL;
+
+    Value next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<Value>(state >> 1);
+    }
+};
+
+// Adapta std::priority_queue a la interfaz de PriorityQueue
+class StdQueue {
+private:
+    std::priority_queue<Value, std::vector<Value>, std::greater<Value>> queue;
+
+public:
+    StdQueue() = default;
+
+    template<class It>
+    StdQueue(It first, It last) : queue(first, last) {}
+
+    void enqueue(Value value) {
+        queue.push(value);
+    }
+
+    Value dequeue() {
+        Value value = queue.top();
+        queue.pop();
+        return value;
+    }
+
+    bool empty() const {
+        return queue.empty();
+    }
+};
+
+template<size_t Arity>
+using MinQueue = PriorityQueue<Value, std::greater<Value>, Arity>;
+
+template<class Q>
+double fill_drain(long long ops) {
+    Random random;
+    auto start = std::chrono::steady_clock::now();
+    Q queue;
+    for (long long i = 0; i < ops / 2; i++) {
+        queue.enqueue(random.next());
+    }
+    Value total = 0;
+    while (!queue.empty()) {
+        total += queue.dequeue();
+    }
+    sink = total;
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<class Q>
+double steady(long long ops, int window) {
+    Random random;
+    Q queue;
+    for (int i = 0; i < window; i++) {
+        queue.enqueue(random.next() >> 20);
+    }
+    auto start = std::chrono::steady_clock::now();
+    Value total = 0;
+    for (long long i = 0; i < ops / 2; i++) {
+        Value now = queue.dequeue();
+        total += now;
+        queue.enqueue(now + (random.next() >> 40));
+    }
+    sink = total;
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<class Q>
+double heapify(long long ops) {
+    Random random;
+    std::vector<Value> input(ops / 2);
+    for (Value &value : input) {
+        value = random.next();
+    }
+    auto start = std::chrono::steady_clock::now();
+    Q queue(input.begin(), input.end());
+    Value total = 0;
+    while (!queue.empty()) {
+        total += queue.dequeue();
+    }
+    sink = total;
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct Graph {
+    std::vector<int> first_edge;   // Aristas de v: first_edge[v] ... first_edge[v + 1] - 1
+    std::vector<int> target;
+    std::vector<Value> weight;
+};
+
+static Graph random_graph(int nodes, int degree) {
+    Random random;
+    Graph graph;
+    graph.first_edge.resize(nodes + 1);
+    for (int v = 0; v <= nodes; v++) {
+        graph.first_edge[v] = v * degree;
+    }
+    for (long long e = 0; e < static_cast<long long>(nodes) * degree; e++) {
+        graph.target.push_back(static_cast<int>(random.next() % nodes));
+        graph.weight.push_back(1 + random.next() % 1000);
+    }
+    return graph;
+}
+
+static const Value INF = std::numeric_limits<Value>::max();
+
+static std::vector<Value> dijkstra_lazy(const Graph &graph, long long &queue_ops) {
+    int nodes = static_cast<int>(graph.first_edge.size()) - 1;
+    std::vector<Value> dist(nodes, INF);
+    using Item = std::pair<Value, int>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item>> queue;
+    dist[0] = 0;
+    queue.push({0, 0});
+    queue_ops = 1;
+    while (!queue.empty()) {
+        auto [d, v] = queue.top();
+        queue.pop();
+        queue_ops++;
+        if (d != dist[v]) {
+            continue;   // Entrada vieja: v ya salió con una distancia menor
+        }
+        for (int e = graph.first_edge[v]; e < graph.first_edge[v + 1]; e++) {
+            int w = graph.target[e];
+            if (d + graph.weight[e] < dist[w]) {
+                dist[w] = d + graph.weight[e];
+                queue.push({dist[w], w});
+                queue_ops++;
+            }
+        }
+    }
+    return dist;
+}
+
+template<size_t Arity>
+std::vector<Value> dijkstra_decrease_key(const Graph &graph, long long &queue_ops) {
+    using Item = std::pair<Value, int>;
+    int nodes = static_cast<int>(graph.first_edge.size()) - 1;
+    std::vector<Value> dist(nodes, INF);
+    std::vector<size_t> handle(nodes);
+    std::vector<bool> queued(nodes, false);
+    PriorityQueue<Item, std::greater<Item>, Arity> queue;
+    dist[0] = 0;
+    handle[0] = queue.enqueue_tracked({0, 0});
+    queued[0] = true;
+    queue_ops = 1;
+    while (!queue.empty()) {
+        int v = queue.dequeue().second;
+        queued[v] = false;
+        queue_ops++;
+        for (int e = graph.first_edge[v]; e < graph.first_edge[v + 1]; e++) {
+            int w = graph.target[e];
+            if (dist[v] + graph.weight[e] < dist[w]) {
+                dist[w] = dist[v] + graph.weight[e];
+                if (queued[w]) {
+                    queue.update(handle[w], {dist[w], w});
+                } else {
+                    handle[w] = queue.enqueue_tracked({dist[w], w});
+                    queued[w] = true;
+                }
+                queue_ops++;
+            }
+        }
+    }
+    return dist;
+}
+
+template<class F>
+double timed(F run) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[]) {
+    long long max_ops = 100000000;
+    int window = 100000;
+    int nodes = 1000000;
+    int degree = 8;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--max-ops") {
+            max_ops = std::stoll(argv[++i]);
+        } else if (arg == "--window") {
+            window = std::stoi(argv[++i]);
+        } else if (arg == "--nodes") {
+            nodes = std::stoi(argv[++i]);
+        } else if (arg == "--degree") {
+            degree = std::stoi(argv[++i]);
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(12) << "pattern" << std::setw(12) << "ops" << std::setw(12) << "std Mops/s"
+              << std::setw(12) << "d=2" << std::setw(12) << "d=4" << std::setw(12) << "d=8" << std::endl;
+
+    for (long long ops = 1000000; ops <= max_ops; ops *= 10) {
+        double times[3][4] = {
+            {fill_drain<StdQueue>(ops), fill_drain<MinQueue<2>>(ops), fill_drain<MinQueue<4>>(ops),
+             fill_drain<MinQueue<8>>(ops)},
+            {steady<StdQueue>(ops, window), steady<MinQueue<2>>(ops, window), steady<MinQueue<4>>(ops, window),
+             steady<MinQueue<8>>(ops, window)},
+            {heapify<StdQueue>(ops), heapify<MinQueue<2>>(ops), heapify<MinQueue<4>>(ops), heapify<MinQueue<8>>(ops)},
+        };
+        const char *patterns[3] = {"fill/drain", "steady", "heapify"};
+        for (int p = 0; p < 3; p++) {
+            std::cout << std::setw(12) << patterns[p] << std::setw(12) << ops;
+            for (double seconds : times[p]) {
+                std::cout << std::setw(12) << ops / seconds / 1e6;
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    Graph graph = random_graph(nodes, degree);
+    std::cout << std::endl << "Dijkstra (" << nodes << " nodes, " << degree << " edges per node)" << std::endl;
+    std::cout << std::setw(24) << "queue" << std::setw(12) << "seconds" << std::setw(14) << "queue ops"
+              << std::setw(10) << "dist" << std::endl;
+
+    std::vector<Value> reference;
+    long long queue_ops = 0;
+    double seconds = timed([&] { reference = dijkstra_lazy(graph, queue_ops); });
+    std::cout << std::setw(24) << "std (lazy deletion)" << std::setw(12) << seconds << std::setw(14) << queue_ops
+              << std::setw(10) << "-" << std::endl;
+
+    bool all_ok = true;
+    auto report = [&](const char *name, auto run) {
+        std::vector<Value> dist;
+        double seconds = timed([&] { dist = run(graph, queue_ops); });
+        bool ok = dist == reference;
+        all_ok = all_ok && ok;
+        std::cout << std::setw(24) << name << std::setw(12) << seconds << std::setw(14) << queue_ops
+                  << std::setw(10) << (ok ? "ok" : "WRONG") << std::endl;
+    };
+    report("d=2 decrease-key", dijkstra_decrease_key<2>);
+    report("d=4 decrease-key", dijkstra_decrease_key<4>);
+    report("d=8 decrease-key", dijkstra_decrease_key<8>);
+
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <list>
+#include <chrono>
+#include <iterator>
+#include "queue_list.h"
+
+// Compara Queue con RingBuffer (por defecto) y Queue con std::list en tres patrones de uso:
+//  - fill/drain: n enqueue seguidos de n dequeue
+//  - steady: la cola mantiene "window" elementos y cada paso hace un dequeue y un enqueue (como binary_classifier)
+//  - bulk: enqueue_range de n elementos y dequeue_n en bloques de 64
+//
+// Uso: ./benchmark_queue [--n N] [--window W]
+
+static volatile long long sink;   // Evita que el compilador elimine los dequeue
+
+static long long weight(char value) { return value; }
+static long long weight(int value) { return value; }
+static long long weight(const std::string &value) { return static_cast<long long>(value.size()); }
+
+template<class Q, class Make>
+double fill_drain(int n, Make make) {
+    auto start = std::chrono::steady_clock::now();
+    Q q;
+    for (int i = 0; i < n; i++) {
+        q.enqueue(make(i));
+    }
+    long long total = 0;
+    while (!q.empty()) {
+        total += weight(q.dequeue());
+    }
+    sink = total;
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<class Q, class Make>
+double steady(int n, int window, Make make) {
+    Q q;
+    for (int i = 0; i < window; i++) {
+        q.enqueue(make(i));
+    }
+    auto start = std::chrono::steady_clock::now();
+    long long total = 0;
+    for (int i = 0; i < n; i++) {
+        total += weight(q.dequeue());
+        q.enqueue(make(i));
+    }
+    sink = total;
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<class Q, class Make>
+double bulk(int n, Make make) {
+    std::vector<decltype(make(0))> input;
+    input.reserve(n);
+    for (int i = 0; i < n; i++) {
+        input.push_back(make(i));
+    }
+    std::vector<decltype(make(0))> output;
+    output.reserve(64);
+
+    auto start = std::chrono::steady_clock::now();
+    Q q;
+    q.enqueue_range(input.begin(), input.end());
+    long long total = 0;
+    while (!q.empty()) {
+        output.clear();
+        total += q.dequeue_n(64, std::back_inserter(output));
+    }
+    sink = total;
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<class T, class Make>
+void run(const std::string &type, int n, int window, Make make) {
+    using ListQueue = Queue<T, std::list>;
+    using RingQueue = Queue<T>;
+
+    double results[3][2] = {
+        {fill_drain<ListQueue>(n, make), fill_drain<RingQueue>(n, make)},
+        {steady<ListQueue>(n, window, make), steady<RingQueue>(n, window, make)},
+        {bulk<ListQueue>(n, make), bulk<RingQueue>(n, make)},
+    };
+    const char *patterns[3] = {"fill/drain", "steady", "bulk"};
+
+    for (int p = 0; p < 3; p++) {
+        double list_mops = n / results[p][0] / 1e6;
+        double ring_mops = n / results[p][1] / 1e6;
+        std::cout << std::setw(12) << type << std::setw(12) << patterns[p]
+                  << std::setw(14) << list_mops << std::setw(14) << ring_mops
+                  << std::setw(10) << ring_mops / list_mops << std::endl;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int n = 5000000;
+    int window = 1000;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--n") {
+            n = std::stoi(argv[++i]);
+        } else if (arg == "--window") {
+            window = std::stoi(argv[++i]);
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(12) << "type" << std::setw(12) << "pattern"
+              << std::setw(14) << "list Mops/s" << std::setw(14) << "ring Mops/s" << std::setw(10) << "speedup" << std::endl;
+
+    run<char>("char", n, window, [](int i) { return static_cast<char>('0' + (i & 1)); });
+    run<int>("int", n, window, [](int i) { return i; });
+    run<std::string>("string", n / 5, window, [](int i) { return "toy-name-" + std::to_string(i) + "-with-heap"; });
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <list>
+#include <chrono>
+#include "stack.h"
+#include "small_stack.h"
+
+// Compara Stack (std::vector y std::list) con SmallStack en ráfagas tipo DFS: en cada ronda se crea una pila nueva,
+// se apilan "depth" nodos y se desapilan todos (con pop y con pop_n en bloques de 32). Con depth = 1, 10, 100, 1000 y
+// 10000 y el mismo total de operaciones, muestra millones de push+pop por segundo. SmallStack<Node, 64> guarda hasta
+// 64 nodos sin memoria dinámica; SmallStack<Node, 1024> hasta 1024.
+//
+// Uso: ./benchmark_stack [--ops N]
+
+struct Node {
+    int id;
+    int depth;
+    Node(int id, int depth) : id(id), depth(depth) {}
+};
+
+static volatile long long sink;   // Evita que el compilador elimine los pop
+
+template<class S>
+double bursts(long long ops, int depth, bool use_pop_n) {
+    long long rounds = std::max<long long>(1, ops / depth);
+    long long total = 0;
+    std::vector<Node> popped;
+    popped.reserve(32);
+    auto start = std::chrono::steady_clock::now();
+    for (long long r = 0; r < rounds; r++) {
+        S stack;
+        for (int d = 0; d < depth; d++) {
+            stack.emplace(static_cast<int>(r), d);
+        }
+        if (use_pop_n) {
+            while (!stack.empty()) {
+                popped.clear();
+                stack.pop_n(32, std::back_inserter(popped));
+                total += popped.back().depth;
+            }
+        } else {
+            while (!stack.empty()) {
+                total += stack.pop().depth;
+            }
+        }
+    }
+    sink = total;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return rounds * depth / seconds / 1e6;
+}
+
+template<class S>
+void row(const std::string &name, long long ops) {
+    std::cout << std::setw(18) << name;
+    for (int depth : {1, 10, 100, 1000, 10000}) {
+        std::cout << std::setw(9) << bursts<S>(ops, depth, false) << std::setw(9) << bursts<S>(ops, depth, true);
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    long long ops = 20000000;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--ops") {
+            ops = std::stoll(argv[++i]);
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Million push+pop per second (pop / pop_n) by burst depth" << std::endl;
+    std::cout << std::setw(18) << "stack";
+    for (int depth : {1, 10, 100, 1000, 10000}) {
+        std::cout << std::setw(18) << "depth " + std::to_string(depth);
+    }
+    std::cout << std::endl;
+
+    row<Stack<Node, std::list>>("Stack<list>", ops);
+    row<Stack<Node>>("Stack<vector>", ops);
+    row<SmallStack<Node, 64>>("SmallStack<64>", ops);
+    row<SmallStack<Node, 1024>>("SmallStack<1024>", ops);
+
+    return 0;
+}
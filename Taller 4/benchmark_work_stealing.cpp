@@ -0,0 +1,130 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include "work_stealing.h"
+
+// Divide y vencerás sobre WorkStealingPool con 1, 2, 4, 8 y 16 hilos:
+//  - fib: fibonacci recursivo; cada llamada con n >= --cutoff crea una tarea para fib(n - 1) y calcula fib(n - 2).
+//  - skewed: suma de un valor pseudoaleatorio sobre [0, --range) partiendo cada rango en 1/5 y 4/5, así que las dos
+//    mitades tienen trabajo muy distinto y el reparto depende de que los hilos libres roben.
+// Para cada cantidad de hilos muestra el tiempo, la aceleración respecto de 1 hilo, el mínimo y el máximo de tareas
+// ejecutadas por un hilo y el total de tareas robadas. Verifica los resultados contra la versión secuencial.
+//
+// Uso: ./benchmark_work_stealing [--fib N] [--cutoff C] [--range R]
+
+static long long fib_sequential(int n) {
+    return n < 2 ? n : fib_sequential(n - 1) + fib_sequential(n - 2);
+}
+
+static long long fib_parallel(WorkStealingPool &pool, int n, int cutoff) {
+    if (n < cutoff) {
+        return fib_sequential(n);
+    }
+    long long left = 0;
+    TaskGroup group;
+    pool.spawn(group, [&pool, &left, n, cutoff] { left = fib_parallel(pool, n - 1, cutoff); });
+    long long right = fib_parallel(pool, n - 2, cutoff);
+    pool.sync(group);
+    return left + right;
+}
+
+static uint64_t mix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    return x;
+}
+
+static uint64_t skewed_sequential(uint64_t low, uint64_t high) {
+    uint64_t sum = 0;
+    for (uint64_t i = low; i < high; i++) {
+        sum += mix(i) >> 40;
+    }
+    return sum;
+}
+
+static uint64_t skewed_parallel(WorkStealingPool &pool, uint64_t low, uint64_t high) {
+    const uint64_t LEAF = 4096;
+    if (high - low <= LEAF) {
+        return skewed_sequential(low, high);
+    }
+    uint64_t split = low + (high - low) / 5;
+    uint64_t left = 0;
+    TaskGroup group;
+    pool.spawn(group, [&pool, &left, low, split] { left = skewed_parallel(pool, low, split); });
+    uint64_t right = skewed_parallel(pool, split, high);
+    pool.sync(group);
+    return left + right;
+}
+
+int main(int argc, char *argv[]) {
+    int fib_n = 36;
+    int cutoff = 12;
+    uint64_t range = 200000000;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--fib") {
+            fib_n = std::stoi(argv[++i]);
+        } else if (arg == "--cutoff") {
+            cutoff = std::stoi(argv[++i]);
+        } else if (arg == "--range") {
+            range = std::stoull(argv[++i]);
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    long long fib_expected = fib_sequential(fib_n);
+    uint64_t skewed_expected = skewed_sequential(0, range);
+
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::setw(8) << "test" << std::setw(9) << "threads" << std::setw(10) << "seconds"
+              << std::setw(10) << "speedup" << std::setw(12) << "min tasks" << std::setw(12) << "max tasks"
+              << std::setw(10) << "stolen" << std::setw(8) << "result" << std::endl;
+
+    bool all_ok = true;
+    for (const std::string test : {"fib", "skewed"}) {
+        double base_seconds = 0;
+        for (int threads : {1, 2, 4, 8, 16}) {
+            WorkStealingPool pool(threads);
+            bool ok = false;
+            auto start = std::chrono::steady_clock::now();
+            pool.run([&] {
+                if (test == "fib") {
+                    ok = fib_parallel(pool, fib_n, cutoff) == fib_expected;
+                } else {
+                    ok = skewed_parallel(pool, 0, range) == skewed_expected;
+                }
+            });
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (threads == 1) {
+                base_seconds = seconds;
+            }
+
+            long long min_tasks = -1, max_tasks = 0, stolen = 0;
+            for (const WorkerStats &stats : pool.stats()) {
+                min_tasks = min_tasks < 0 ? stats.executed : std::min(min_tasks, stats.executed);
+                max_tasks = std::max(max_tasks, stats.executed);
+                stolen += stats.stolen;
+            }
+            all_ok = all_ok && ok;
+            std::cout << std::setw(8) << test << std::setw(9) << threads << std::setw(10) << seconds
+                      << std::setw(10) << base_seconds / seconds << std::setw(12) << min_tasks
+                      << std::setw(12) << max_tasks << std::setw(10) << stolen
+                      << std::setw(8) << (ok ? "ok" : "WRONG") << std::endl;
+        }
+    }
+
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+#ifndef BIT_QUEUE_H
+#define BIT_QUEUE_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+// Cola de bits empaquetados en palabras de 64 bits. El bit i de la cola (contando desde el frente) está en la
+// posición head + i, donde la posición p es el bit (p % 64) de la palabra p / 64. Quitar n bits del frente solo
+// avanza "head" y agregar hasta 64 bits al final son un par de desplazamientos y máscaras.
+class BitQueue {
+private:
+    std::vector<uint64_t> words;
+    size_t head = 0;   // Posición del primer bit
+    size_t tail = 0;   // Posición después del último bit
+
+    static uint64_t low_mask(int count) {
+        return count >= 64 ? ~uint64_t(0) : (uint64_t(1) << count) - 1;
+    }
+
+    /**
+     * @brief Mueve las palabras vivas al inicio del vector para reutilizar las que ya se consumieron.
+     */
+    void compact() {
+        size_t first = head / 64;
+        size_t last = (tail + 63) / 64;
+        std::copy(words.begin() + first, words.begin() + last, words.begin());
+        head -= first * 64;
+        tail -= first * 64;
+    }
+
+    /**
+     * @brief Garantiza espacio para "extra" bits más al final. O(1) amortizado: solo compacta cuando
+     *        la mitad del vector ya fue consumida y solo crece duplicando.
+     */
+    void reserve_back(size_t extra) {
+        size_t needed = (tail + extra) / 64 + 1;
+        if (needed <= words.size()) {
+            return;
+        }
+        if (head / 64 >= words.size() / 2 && head >= 64) {
+            compact();
+            needed = (tail + extra) / 64 + 1;
+        }
+        if (needed > words.size()) {
+            words.resize(std::max(needed, 2 * words.size()));
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor por defecto. Crea una cola vacía.
+     */
+    BitQueue() = default;
+
+    /**
+     * @brief Crea la cola a partir de una cadena de '0' y '1' (el primer carácter queda al frente).
+     * @throws std::invalid_argument si la cadena tiene otros caracteres.
+     */
+    explicit BitQueue(const std::string &bin) {
+        words.assign(bin.size() / 64 + 1, 0);
+        for (char c : bin) {
+            if (c != '0' && c != '1') {
+                throw std::invalid_argument("Invalid binary number");
+            }
+            if (c == '1') {
+                words[tail / 64] |= uint64_t(1) << (tail % 64);
+            }
+            tail++;
+        }
+    }
+
+    /**
+     * @brief Verifica si la cola está vacía.
+     */
+    bool empty() const {
+        return head == tail;
+    }
+
+    /**
+     * @brief Obtiene el número de bits en la cola.
+     */
+    size_t size() const {
+        return tail - head;
+    }
+
+    /**
+     * @brief Devuelve el bit del frente (la cola no debe estar vacía).
+     */
+    bool front() const {
+        return (words[head / 64] >> (head % 64)) & 1;
+    }
+
+    /**
+     * @brief Devuelve el bit i contando desde el frente.
+     */
+    bool bit(size_t i) const {
+        size_t p = head + i;
+        return (words[p / 64] >> (p % 64)) & 1;
+    }
+
+    /**
+     * @brief Devuelve "count" bits (count <= 64) a partir del bit i contando desde el frente (i + count <= size()).
+     *        El bit i queda en el bit 0 del resultado.
+     */
+    uint64_t bits_at(size_t i, int count) const {
+        size_t p = head + i;
+        size_t w = p / 64;
+        int offset = static_cast<int>(p % 64);
+        uint64_t value = words[w] >> offset;
+        if (offset != 0 && offset + count > 64) {
+            value |= words[w + 1] << (64 - offset);
+        }
+        return value & low_mask(count);
+    }
+
+    /**
+     * @brief Devuelve los primeros "count" bits (count <= 64 y count <= size()); el bit del frente queda en el bit 0.
+     */
+    uint64_t peek(int count) const {
+        return bits_at(0, count);
+    }
+
+    /**
+     * @brief Quita n bits del frente (n <= size()).
+     */
+    void pop_front(size_t n = 1) {
+        head += n;
+        if (head == tail) {
+            head = tail = 0;
+        }
+    }
+
+    /**
+     * @brief Agrega "count" bits (count <= 64) al final. El bit 0 de "bits" es el primero en agregarse.
+     */
+    void append_bits(uint64_t bits, int count) {
+        if ((tail + count) / 64 + 1 > words.size()) {
+            reserve_back(count);
+        }
+        bits &= low_mask(count);
+        size_t w = tail / 64;
+        int offset = static_cast<int>(tail % 64);
+        words[w] = (words[w] & ((uint64_t(1) << offset) - 1)) | (bits << offset);
+        if (offset + count > 64) {
+            words[w + 1] = bits >> (64 - offset);
+        }
+        tail += count;
+    }
+
+    /**
+     * @brief Agrega un bit al final.
+     */
+    void push_back(bool value) {
+        append_bits(value ? 1 : 0, 1);
+    }
+
+    /**
+     * @brief Compara el contenido de dos colas (los mismos bits en el mismo orden), sin importar cómo estén alineados
+     *        en sus palabras.
+     */
+    bool operator==(const BitQueue &other) const {
+        size_t n = size();
+        if (n != other.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < n; i += 64) {
+            int count = static_cast<int>(std::min<size_t>(64, n - i));
+            if (bits_at(i, count) != other.bits_at(i, count)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator!=(const BitQueue &other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Representación compacta del contenido (los bits realineados desde el bit 0, más la longitud).
+     *        Dos colas tienen la misma representación si y solo si tienen los mismos bits.
+     */
+    std::string packed() const {
+        size_t n = size();
+        std::string key((n + 63) / 64 * 8 + sizeof(n), '\0');
+        char *out = &key[0];
+        for (size_t i = 0; i < n; i += 64) {
+            uint64_t value = bits_at(i, static_cast<int>(std::min<size_t>(64, n - i)));
+            std::memcpy(out, &value, 8);
+            out += 8;
+        }
+        std::memcpy(out, &n, sizeof(n));
+        return key;
+    }
+
+    /**
+     * @brief Devuelve el contenido como cadena de '0' y '1'.
+     */
+    std::string to_string() const {
+        std::string bin(size(), '0');
+        for (size_t i = 0; i < bin.size(); i++) {
+            if (bit(i)) {
+                bin[i] = '1';
+            }
+        }
+        return bin;
+    }
+};
+
+#endif // BIT_QUEUE_H
@@ -0,0 +1,257 @@
+#ifndef BLOCKING_QUEUE_H
+#define BLOCKING_QUEUE_H
+
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <iterator>
+#include <stdexcept>
+#include <cstddef>
+#include <climits>
+#include <algorithm>
+#include "queue_list.h"
+
+// Qué hace un productor cuando la cola está llena
+enum class BackPressure {
+    Block,        // Espera a que haya espacio (o a que venza el plazo en las variantes _for)
+    DropNewest,   // Descarta los elementos que no caben
+    DropOldest    // Descarta los elementos más antiguos de la cola para hacer lugar
+};
+
+// Cola acotada para comunicar etapas de un pipeline entre hilos, construida sobre Queue con un mutex y dos variables de
+// condición. Las operaciones _bulk mueven un lote entero con una sola toma del mutex (o una por cada vez que la cola
+// se llena o se vacía), en lugar de una por elemento. Las variantes _for aceptan un plazo máximo de espera.
+// close() indica que no habrá más elementos: los productores dejan de agregar y los consumidores vacían lo que queda
+// y luego reciben 0 / false en lugar de esperar.
+template<class T>
+class BlockingQueue {
+private:
+    Queue<T> queue;
+    const size_t capacity;
+    const BackPressure policy;
+    mutable std::mutex mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    bool closed = false;
+    long long dropped_count = 0;
+
+    size_t free_space() const {
+        return capacity - static_cast<size_t>(queue.size());
+    }
+
+    // Agrega lo que quepa de [first, last) según la política; devuelve cuántos elementos consumió de la entrada
+    // (agregados o descartados) y suma a "added" los que agregó. Se llama con el mutex tomado
+    template<class InputIt>
+    size_t push_some(InputIt &first, size_t remaining, size_t &added) {
+        size_t taken = 0;
+        while (taken < remaining) {
+            if (free_space() == 0) {
+                if (policy == BackPressure::Block) {
+                    break;
+                }
+                dropped_count++;
+                if (policy == BackPressure::DropNewest) {
+                    ++first;
+                    taken++;
+                    continue;
+                }
+                queue.dequeue();
+            }
+            queue.enqueue(std::move(*first));
+            ++first;
+            taken++;
+            added++;
+        }
+        return taken;
+    }
+
+    template<class InputIt, class Wait>
+    size_t enqueue_range(InputIt first, InputIt last, Wait wait, size_t &added) {
+        size_t total = static_cast<size_t>(std::distance(first, last));
+        size_t done = 0;
+        added = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (done < total && !closed) {
+            size_t before = added;
+            done += push_some(first, total - done, added);
+            if (added - before == 1) {
+                not_empty.notify_one();
+            } else if (added > before) {
+                not_empty.notify_all();
+            }
+            // Solo BackPressure::Block puede dejar elementos sin procesar
+            if (done < total && !wait(lock, [this] { return closed || free_space() > 0; })) {
+                break;   // Venció el plazo
+            }
+        }
+        return done;
+    }
+
+    template<class OutputIt, class Wait>
+    size_t dequeue_range(OutputIt out, size_t max_items, Wait wait) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!wait(lock, [this] { return closed || !queue.empty(); })) {
+            return 0;
+        }
+        int limit = static_cast<int>(std::min<size_t>(max_items, INT_MAX));
+        size_t removed = static_cast<size_t>(queue.dequeue_n(limit, out));
+        if (removed > 0) {
+            not_full.notify_all();
+        }
+        return removed;
+    }
+
+    // Formas de esperar sobre una variable de condición: sin plazo o hasta un instante
+    struct WaitForever {
+        std::condition_variable &condition;
+
+        template<class Predicate>
+        bool operator()(std::unique_lock<std::mutex> &lock, Predicate ready) const {
+            condition.wait(lock, ready);
+            return true;
+        }
+    };
+
+    struct WaitUntil {
+        std::condition_variable &condition;
+        std::chrono::steady_clock::time_point deadline;
+
+        template<class Predicate>
+        bool operator()(std::unique_lock<std::mutex> &lock, Predicate ready) const {
+            return condition.wait_until(lock, deadline, ready);
+        }
+    };
+
+    template<class Rep, class Period>
+    static std::chrono::steady_clock::time_point deadline_after(const std::chrono::duration<Rep, Period> &timeout) {
+        return std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+    }
+
+public:
+    /**
+     * @brief Crea una cola vacía que guarda a lo sumo "capacity" elementos.
+     * @param policy Qué hacer cuando un productor encuentra la cola llena.
+     * @throws std::invalid_argument si capacity es 0.
+     */
+    explicit BlockingQueue(size_t capacity, BackPressure policy = BackPressure::Block)
+        : capacity(capacity), policy(policy) {
+        if (capacity == 0) {
+            throw std::invalid_argument("La capacidad debe ser mayor que cero");
+        }
+    }
+
+    /**
+     * @brief Agrega un elemento. Con BackPressure::Block espera mientras la cola esté llena.
+     * @return false si la cola está cerrada o el elemento se descartó (DropNewest).
+     */
+    bool enqueue(T value) {
+        size_t added = 0;
+        enqueue_range(&value, &value + 1, WaitForever{not_full}, added);
+        return added == 1;
+    }
+
+    /**
+     * @brief Agrega un lote [first, last) (iteradores de avance; los elementos se mueven) tomando el mutex una vez por
+     *        cada tramo que quepa.
+     *        Con BackPressure::Block espera hasta agregarlo entero; con las otras políticas no espera nunca.
+     * @return Cuántos elementos de la entrada se procesaron (agregados o descartados por la política); menos que el
+     *         total solo si la cola se cerró.
+     */
+    template<class InputIt>
+    size_t enqueue_bulk(InputIt first, InputIt last) {
+        size_t added = 0;
+        return enqueue_range(first, last, WaitForever{not_full}, added);
+    }
+
+    /**
+     * @brief Como enqueue_bulk, pero espera espacio a lo sumo "timeout".
+     * @return Cuántos elementos de la entrada se procesaron antes de que venciera el plazo.
+     */
+    template<class InputIt, class Rep, class Period>
+    size_t enqueue_bulk_for(InputIt first, InputIt last, const std::chrono::duration<Rep, Period> &timeout) {
+        size_t added = 0;
+        return enqueue_range(first, last, WaitUntil{not_full, deadline_after(timeout)}, added);
+    }
+
+    /**
+     * @brief Agrega un elemento esperando espacio a lo sumo "timeout".
+     * @return true si se agregó.
+     */
+    template<class Rep, class Period>
+    bool enqueue_for(T value, const std::chrono::duration<Rep, Period> &timeout) {
+        size_t added = 0;
+        enqueue_range(&value, &value + 1, WaitUntil{not_full, deadline_after(timeout)}, added);
+        return added == 1;
+    }
+
+    /**
+     * @brief Quita el elemento del frente, esperando mientras la cola esté vacía.
+     * @return false si la cola está cerrada y vacía.
+     */
+    bool dequeue(T &out) {
+        return dequeue_bulk(&out, 1) == 1;
+    }
+
+    /**
+     * @brief Quita el elemento del frente esperando a lo sumo "timeout".
+     * @return false si venció el plazo o la cola está cerrada y vacía.
+     */
+    template<class Rep, class Period>
+    bool dequeue_for(T &out, const std::chrono::duration<Rep, Period> &timeout) {
+        return dequeue_bulk_for(&out, 1, timeout) == 1;
+    }
+
+    /**
+     * @brief Espera a que haya al menos un elemento y quita hasta max_items (movidos a "out", en orden) con una sola
+     *        toma del mutex.
+     * @return Cuántos elementos quitó; 0 solo si la cola está cerrada y vacía.
+     */
+    template<class OutputIt>
+    size_t dequeue_bulk(OutputIt out, size_t max_items) {
+        return dequeue_range(out, max_items, WaitForever{not_empty});
+    }
+
+    /**
+     * @brief Como dequeue_bulk, pero espera a lo sumo "timeout".
+     * @return Cuántos elementos quitó (0 si venció el plazo o la cola está cerrada y vacía).
+     */
+    template<class OutputIt, class Rep, class Period>
+    size_t dequeue_bulk_for(OutputIt out, size_t max_items, const std::chrono::duration<Rep, Period> &timeout) {
+        return dequeue_range(out, max_items, WaitUntil{not_empty, deadline_after(timeout)});
+    }
+
+    /**
+     * @brief Cierra la cola y despierta a todos los hilos que esperan.
+     */
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        not_empty.notify_all();
+        not_full.notify_all();
+    }
+
+    bool is_closed() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return closed;
+    }
+
+    bool empty() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return queue.empty();
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return static_cast<size_t>(queue.size());
+    }
+
+    /**
+     * @brief Elementos descartados por la política de contrapresión.
+     */
+    long long dropped() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return dropped_count;
+    }
+};
+
+#endif // BLOCKING_QUEUE_H
@@ -0,0 +1,100 @@
+#ifndef CLASSIFICATION_MEMO_H
+#define CLASSIFICATION_MEMO_H
+
+#include <vector>
+#include <mutex>
+#include <memory>
+#include <unordered_map>
+#include <cstddef>
+#include "state_fingerprint.h"
+
+// Tabla compartida entre hilos: huella de un estado de la cola -> clasificación final de ese estado (bucle o no).
+// Todos los estados de una trayectoria tienen la misma clasificación que su estado inicial, así que un hilo que
+// llega a un estado que otro ya resolvió puede detenerse ahí.
+//
+// La tabla se reparte en SHARDS fragmentos, cada uno con su propio mutex (elegido por bits altos de la huella), para que
+// los hilos casi nunca compitan por el mismo bloqueo. Cada fragmento guarda a lo sumo max_entries / SHARDS estados:
+// cuando se llena, las inserciones se ignoran (la tabla solo acelera, nunca cambia el resultado).
+class ClassificationMemo {
+private:
+    static constexpr int SHARDS = 64;
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_map<StateFingerprint::Key, bool, StateFingerprint::KeyHash> loops;
+        long long lookups = 0;
+        long long hits = 0;
+    };
+
+    std::unique_ptr<Shard[]> shards;
+    size_t max_entries_per_shard;
+
+    Shard& shard_for(const StateFingerprint::Key &key) const {
+        // h1 < 2^61: sus bits altos no se usan en el hash de unordered_map (que mezcla sobre todo h0)
+        return shards[(key.h1 >> 55) % SHARDS];
+    }
+
+public:
+    /**
+     * @brief Crea una tabla vacía que guardará a lo sumo unas max_entries huellas.
+     */
+    explicit ClassificationMemo(size_t max_entries = size_t(1) << 21)
+        : shards(new Shard[SHARDS]), max_entries_per_shard((max_entries + SHARDS - 1) / SHARDS) {}
+
+    /**
+     * @brief Busca la clasificación de un estado.
+     * @param loops Recibe true si el estado entra en un bucle (solo si se encontró).
+     * @return true si el estado ya estaba resuelto.
+     */
+    bool find(const StateFingerprint::Key &key, bool &loops) {
+        Shard &shard = shard_for(key);
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        shard.lookups++;
+        auto it = shard.loops.find(key);
+        if (it == shard.loops.end()) {
+            return false;
+        }
+        shard.hits++;
+        loops = it->second;
+        return true;
+    }
+
+    /**
+     * @brief Registra la clasificación de todos los estados de una trayectoria.
+     */
+    void insert_all(const std::vector<StateFingerprint::Key> &keys, bool loops) {
+        for (const StateFingerprint::Key &key : keys) {
+            Shard &shard = shard_for(key);
+            std::lock_guard<std::mutex> guard(shard.mutex);
+            if (shard.loops.size() < max_entries_per_shard) {
+                shard.loops.emplace(key, loops);
+            }
+        }
+    }
+
+    /**
+     * @brief Número de estados guardados.
+     */
+    size_t size() const {
+        size_t total = 0;
+        for (int i = 0; i < SHARDS; i++) {
+            std::lock_guard<std::mutex> guard(shards[i].mutex);
+            total += shards[i].loops.size();
+        }
+        return total;
+    }
+
+    /**
+     * @brief Número de búsquedas hechas y cuántas encontraron el estado.
+     */
+    void counters(long long &lookups, long long &hits) const {
+        lookups = hits = 0;
+        for (int i = 0; i < SHARDS; i++) {
+            std::lock_guard<std::mutex> guard(shards[i].mutex);
+            lookups += shards[i].lookups;
+            hits += shards[i].hits;
+        }
+    }
+};
+
+#endif // CLASSIFICATION_MEMO_H
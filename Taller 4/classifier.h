@@ -0,0 +1,262 @@
+#ifndef CLASSIFIER_H
+#define CLASSIFIER_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "queue_list.h"
+#include "bit_queue.h"
+#include "state_fingerprint.h"
+#include "classification_memo.h"
+
+
+// Función helper para imprimir la Queue (copia)
+inline void print_queue(Queue<char> q) {
+    while (!q.empty()) {
+        std::cout << q.dequeue() << " ";
+    }
+    std::cout << std::endl;
+}
+
+// Función helper para convertir un string a una Queue
+inline Queue<char> make_queue_from_binary(const std::string &bin_str) {
+    Queue<char> q;
+    for (char c : bin_str) {
+        if (c == '0' || c == '1') {
+            q.enqueue(c);
+        } else {
+            throw std::invalid_argument("Invalid binary number");
+        }
+    }
+    return q;
+}
+
+// Función helper para convertir una Queue de enteros a un string
+inline std::string make_string_from_queue(Queue<char> q) {
+	std::string bin;
+	while (!q.empty()) {
+		bin += q.dequeue();
+	}
+	return bin;
+}
+
+// Función de clasificación. Clasifica 00 a aquellos que con las reglas no entran en un bucle, y con 1101 a aquellos que resultan en un bucle.
+// Con verbose=false no imprime la cola inicial ni el estado donde se encontró el bucle.
+inline std::string binary_classifier(std::string &bin, bool verbose = true) {
+    Queue<char> q = make_queue_from_binary(bin);
+	// Huellas de los estados de la cola. Si se vuelve a un estado después de haber aplicado las reglas, se considera un bucle.
+	// La huella se actualiza con cada bit que sale o entra, así que revisar un estado no requiere copiar la cola
+	FingerprintSet seen;
+	StateFingerprint fingerprint;
+	for (char c : bin) {
+		fingerprint.append_bits(c == '1', 1);
+	}
+
+    // Imprimir la cola inicial
+    if (verbose) {
+        std::cout << "Initial queue: ";
+        print_queue(q);
+    }
+
+    // Mientras haya al menos 3 bits en la cola
+    while (q.size() >= 3) {
+		// Comprobar si el estado actual ya ha sido visitado
+		if (!seen.insert(fingerprint.key())) {
+			if (verbose) {
+				std::cout << "Loop found at: ";
+				print_queue(q);
+				std::cout << std::endl;
+			}
+			return "1101";
+		}
+
+
+        char front = q.front();  // Obtener el primer bit
+
+        // Eliminar los primeros 3 bits
+        for (int i = 0; i < 3; i++) {
+            fingerprint.pop_front(q.dequeue() == '1', 1);
+        }
+
+        // Añadir bits según la regla
+        if (front == '0') {
+            q.enqueue('0');
+            q.enqueue('0');
+            fingerprint.append_bits(0b00, 2);
+        } else if (front == '1') {
+            q.enqueue('1');
+            q.enqueue('1');
+            q.enqueue('0');
+            q.enqueue('1');
+            fingerprint.append_bits(0b1011, 4);
+        }
+    }
+
+	// En este punto la cadena no entró en un bucle, por lo tanto, su última iteración fue de la forma 0xx y su clasificación es 00
+	return "00";
+}
+
+// Aplica un paso de la regla sobre una cola de bits: quita los 3 primeros bits y agrega 00 si el primero era 0, o 1101 si era 1.
+// Los bits agregados se escriben de una vez y sin saltos condicionales (1101 leído desde el frente es 0b1011 con el
+// primer bit en el bit 0; 00 es 0 con longitud 2)
+// Si se pasa una huella, se actualiza junto con la cola
+inline void apply_tag_rule(BitQueue &q, StateFingerprint *fingerprint = nullptr) {
+    uint64_t front = q.front();
+    if (fingerprint != nullptr) {
+        fingerprint->pop_front(q.peek(3), 3);
+        fingerprint->append_bits(front * 0b1011, 2 + 2 * static_cast<int>(front));
+    }
+    q.pop_front(3);
+    q.append_bits(front * 0b1011, 2 + 2 * static_cast<int>(front));
+}
+
+// Aplica hasta max_steps pasos de la regla (se detiene antes si quedan menos de 3 bits) y devuelve cuántos aplicó.
+// Mientras la cola tenga al menos 63 bits, los primeros bits de los siguientes 21 pasos son los bits 0, 3, ..., 60
+// (ninguno de esos pasos llega a leer bits agregados), así que se quitan los 63 bits de una vez y se agregan los
+// bits de los 21 pasos en dos bloques de hasta 44 bits
+inline long long advance_tag_rule(BitQueue &q, long long max_steps, StateFingerprint *fingerprint = nullptr) {
+    const int BLOCK_STEPS = 21;
+    long long done = 0;
+    while (done < max_steps && q.size() >= 3) {
+        if (q.size() < 3 * BLOCK_STEPS || max_steps - done < BLOCK_STEPS) {
+            apply_tag_rule(q, fingerprint);
+            done++;
+            continue;
+        }
+        uint64_t block = q.peek(3 * BLOCK_STEPS);
+        q.pop_front(3 * BLOCK_STEPS);
+        if (fingerprint != nullptr) {
+            fingerprint->pop_front(block, 3 * BLOCK_STEPS);
+        }
+        for (int first = 0; first < BLOCK_STEPS; first += 11) {
+            int last = std::min(first + 11, BLOCK_STEPS);
+            uint64_t out = 0;
+            int length = 0;
+            for (int i = first; i < last; i++) {
+                uint64_t front = (block >> (3 * i)) & 1;
+                out |= (front * 0b1011) << length;
+                length += 2 + 2 * static_cast<int>(front);
+            }
+            q.append_bits(out, length);
+            if (fingerprint != nullptr) {
+                fingerprint->append_bits(out, length);
+            }
+        }
+        done += BLOCK_STEPS;
+    }
+    return done;
+}
+
+// Huella de todo el contenido de una cola de bits (se agrega de a 64 bits)
+inline StateFingerprint fingerprint_of(const BitQueue &q) {
+    StateFingerprint fingerprint;
+    for (size_t i = 0; i < q.size(); i += 64) {
+        int count = static_cast<int>(std::min<size_t>(64, q.size() - i));
+        fingerprint.append_bits(q.bits_at(i, count), count);
+    }
+    return fingerprint;
+}
+
+// Forma de detectar bucles en binary_classifier_fast
+enum class LoopDetection {
+    HashSet,   // Guarda la huella de cada estado revisado: encuentra el bucle apenas se repite un estado
+    Brent      // Algoritmo de Brent: solo guarda una huella (memoria O(1)), a cambio de hasta ~2 vueltas más del ciclo
+};
+
+// Misma clasificación que binary_classifier, pero con el estado en una BitQueue (64 bits por palabra) y huellas
+// incrementales en lugar de copias de la cola. No imprime nada. El tiempo es lineal en el número de pasos.
+// Solo se revisa el estado cada CHECK_STEPS pasos: si la trayectoria entra en un ciclo, los estados muestreados
+// también se repiten (a partir del ciclo, el estado en el paso t y en t + CHECK_STEPS * periodo es el mismo), y si
+// termina nunca repite estados, así que la clasificación es la misma que revisando cada paso
+inline std::string binary_classifier_fast(const std::string &bin, LoopDetection mode = LoopDetection::HashSet) {
+    const long long CHECK_STEPS = 21;
+    BitQueue q(bin);
+    StateFingerprint fingerprint = fingerprint_of(q);
+
+    if (mode == LoopDetection::HashSet) {
+        FingerprintSet seen;
+        while (q.size() >= 3) {
+            if (!seen.insert(fingerprint.key())) {
+                return "1101";
+            }
+            advance_tag_rule(q, CHECK_STEPS, &fingerprint);
+        }
+        return "00";
+    }
+
+    // Brent sobre la función "avanzar CHECK_STEPS pasos": la tortuga se queda quieta en potencias de dos
+    // mientras la liebre avanza; si la liebre vuelve a la huella de la tortuga, hay un ciclo
+    if (q.size() < 3) {
+        return "00";
+    }
+    StateFingerprint::Key tortoise = fingerprint.key();
+    long long power = 1;
+    long long lambda = 1;
+    advance_tag_rule(q, CHECK_STEPS, &fingerprint);
+    while (q.size() >= 3) {
+        if (fingerprint.key() == tortoise) {
+            return "1101";
+        }
+        if (power == lambda) {
+            tortoise = fingerprint.key();
+            power *= 2;
+            lambda = 0;
+        }
+        advance_tag_rule(q, CHECK_STEPS, &fingerprint);
+        lambda++;
+    }
+    return "00";
+}
+
+// Misma clasificación que binary_classifier_fast, consultando y llenando una tabla compartida entre hilos.
+// Para que dos trayectorias que pasan por el mismo estado se encuentren en la tabla sin importar en qué paso llegaron,
+// solo se consultan y guardan los estados "distinguidos" (huella con h0 múltiplo de MEMO_STRIDE, es decir, 1 de cada
+// MEMO_STRIDE estados en promedio) más el estado inicial. Una vez que dos trayectorias se juntan, la siguiente visita
+// a un estado distinguido ya está en la tabla. Por eso se avanza de a un paso, y los bucles propios se detectan
+// como en binary_classifier_fast (un estado cada CHECK_STEPS pasos), porque un ciclo corto puede no tener estados
+// distinguidos.
+// Casi todas las trayectorias terminan en pocos miles de pasos; las que pasan de MEMO_STEPS siguen sin la tabla y de a
+// bloques, para que unas pocas trayectorias de millones de pasos no llenen la tabla ni se ejecuten a la velocidad de
+// un paso por vez.
+inline std::string binary_classifier_memo(const std::string &bin, ClassificationMemo &memo) {
+    const long long CHECK_STEPS = 21;
+    const long long MEMO_STEPS = CHECK_STEPS * 4096;
+    const uint64_t MEMO_STRIDE = 16;
+    BitQueue q(bin);
+    StateFingerprint fingerprint = fingerprint_of(q);
+    FingerprintSet seen;
+    std::vector<StateFingerprint::Key> path;   // Estados distinguidos visitados, para guardarlos al final
+
+    bool loops = false;
+    bool resolved = false;
+    for (long long step = 0; step < MEMO_STEPS && q.size() >= 3; step++) {
+        StateFingerprint::Key key = fingerprint.key();
+        if (step == 0 || key.h0 % MEMO_STRIDE == 0) {
+            if (memo.find(key, loops)) {
+                resolved = true;
+                break;
+            }
+            path.push_back(key);
+        }
+        if (step % CHECK_STEPS == 0 && !seen.insert(key)) {
+            loops = true;
+            resolved = true;
+            break;
+        }
+        apply_tag_rule(q, &fingerprint);
+    }
+
+    // Trayectoria larga: se sigue revisando cada CHECK_STEPS pasos (MEMO_STEPS es múltiplo de CHECK_STEPS)
+    while (!resolved && q.size() >= 3) {
+        if (!seen.insert(fingerprint.key())) {
+            loops = true;
+            break;
+        }
+        advance_tag_rule(q, CHECK_STEPS, &fingerprint);
+    }
+    memo.insert_all(path, loops);
+    return loops ? "1101" : "00";
+}
+
+#endif // CLASSIFIER_H
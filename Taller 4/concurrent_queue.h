@@ -0,0 +1,329 @@
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <thread>
+#include <utility>
+#include <stdexcept>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+
+// Colas acotadas para compartir entre hilos sin mutex. Tienen la interfaz de Queue (enqueue, dequeue, empty, size) con
+// dos diferencias: la capacidad es fija (se redondea a potencia de dos) y enqueue/dequeue esperan (girando y cediendo
+// el procesador) mientras la cola está llena o vacía en lugar de crecer o lanzar una excepción. try_enqueue y
+// try_dequeue nunca esperan.
+//
+// Los índices que escribe cada lado están en líneas de caché distintas (CACHE_LINE bytes), para que el productor y el
+// consumidor no se invaliden mutuamente la línea en cada operación.
+
+// Auxiliares compartidos con work_stealing.h; van en su propio espacio de nombres para no chocar con otros headers
+namespace concurrent_detail {
+
+constexpr size_t CACHE_LINE = 64;
+
+// Espera activa corta y luego cede el procesador (con más hilos que núcleos, girar sin ceder solo retrasa a quien
+// tiene que liberar la cola)
+inline void backoff(int &spins) {
+    if (++spins >= 64) {
+        std::this_thread::yield();
+    }
+}
+
+inline size_t round_up_to_power_of_two(size_t n) {
+    if (n == 0) {
+        throw std::invalid_argument("La capacidad debe ser mayor que cero");
+    }
+    size_t capacity = 1;
+    while (capacity < n) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+} // namespace concurrent_detail
+
+// Cola de un productor y un consumidor: cada lado escribe solo su índice, así que ambas operaciones terminan en un
+// número acotado de pasos (wait-free). Cada lado guarda una copia del índice del otro y solo vuelve a leer el atómico
+// cuando la copia indica que la cola está llena (productor) o vacía (consumidor).
+template<class T>
+class SpscQueue {
+private:
+    const size_t capacity;
+    const size_t mask;
+    T *slots;
+
+    alignas(concurrent_detail::CACHE_LINE) std::atomic<size_t> head{0};   // Lo escribe el consumidor
+    size_t cached_tail = 0;                            // Copia del consumidor
+
+    alignas(concurrent_detail::CACHE_LINE) std::atomic<size_t> tail{0};   // Lo escribe el productor
+    size_t cached_head = 0;                            // Copia del productor
+
+    template<class U>
+    bool push(U &&value) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cached_head == capacity) {
+            cached_head = head.load(std::memory_order_acquire);
+            if (t - cached_head == capacity) {
+                return false;
+            }
+        }
+        ::new (slots + (t & mask)) T(std::forward<U>(value));
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+public:
+    /**
+     * @brief Crea una cola con espacio para al menos "capacity" elementos.
+     * @throws std::invalid_argument si capacity es 0.
+     */
+    explicit SpscQueue(size_t capacity)
+        : capacity(concurrent_detail::round_up_to_power_of_two(capacity)), mask(this->capacity - 1),
+          slots(static_cast<T *>(::operator new(this->capacity * sizeof(T)))) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    ~SpscQueue() {
+        for (size_t i = head.load(); i != tail.load(); i++) {
+            slots[i & mask].~T();
+        }
+        ::operator delete(slots);
+    }
+
+    /**
+     * @brief Intenta agregar un elemento (solo desde el hilo productor).
+     * @return false si la cola está llena.
+     */
+    bool try_enqueue(const T& value) {
+        return push(value);
+    }
+
+    bool try_enqueue(T&& value) {
+        return push(std::move(value));
+    }
+
+    /**
+     * @brief Agrega un elemento, esperando mientras la cola esté llena.
+     */
+    void enqueue(const T& value) {
+        for (int spins = 0; !push(value); concurrent_detail::backoff(spins)) {}
+    }
+
+    void enqueue(T&& value) {
+        for (int spins = 0; !push(std::move(value)); concurrent_detail::backoff(spins)) {}
+    }
+
+    /**
+     * @brief Intenta quitar el elemento del frente (solo desde el hilo consumidor). El elemento se mueve a "out".
+     * @return false si la cola está vacía.
+     */
+    bool try_dequeue(T& out) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == cached_tail) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            if (h == cached_tail) {
+                return false;
+            }
+        }
+        T *slot = slots + (h & mask);
+        out = std::move(*slot);
+        slot->~T();
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Quita y devuelve el elemento del frente, esperando mientras la cola esté vacía.
+     */
+    T dequeue() {
+        size_t h = head.load(std::memory_order_relaxed);
+        for (int spins = 0; h == tail.load(std::memory_order_acquire); concurrent_detail::backoff(spins)) {}
+        T *slot = slots + (h & mask);
+        T value = std::move(*slot);
+        slot->~T();
+        head.store(h + 1, std::memory_order_release);
+        return value;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Número de elementos (exacto solo si ningún otro hilo está usando la cola).
+     */
+    size_t size() const {
+        size_t h = head.load(std::memory_order_acquire);
+        size_t t = tail.load(std::memory_order_acquire);
+        return t - h;
+    }
+};
+
+// Cola acotada de varios productores y varios consumidores (algoritmo de Dmitry Vyukov). Cada casilla tiene un número
+// de secuencia que indica de quién es el turno: en la vuelta v, la casilla i está libre para el productor de la
+// posición p = v * capacity + i cuando su secuencia vale p, y lista para el consumidor cuando vale p + 1. Productores
+// y consumidores reservan posiciones con CAS sobre su índice y solo compiten entre ellos en ese CAS; no hay bloqueos.
+//
+// Una posición reservada tiene que publicarse sí o sí: si el constructor de T lanzara después del CAS, la casilla
+// quedaría sin publicar y todos los consumidores que lleguen a ella esperarían para siempre. Por eso las copias se
+// hacen antes de reservar y dentro de push solo se mueve, lo que T debe garantizar sin excepciones.
+template<class T>
+class MpmcQueue {
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "MpmcQueue necesita que mover T no lance excepciones");
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *value() {
+            return reinterpret_cast<T *>(storage);
+        }
+    };
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<Cell[]> cells;
+
+    alignas(concurrent_detail::CACHE_LINE) std::atomic<size_t> enqueue_pos{0};
+    alignas(concurrent_detail::CACHE_LINE) std::atomic<size_t> dequeue_pos{0};   // El tamaño de la clase se redondea a CACHE_LINE
+
+    // Solo mueve "value" si lo pudo agregar
+    bool push(T &&value) {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell &cell = cells[pos & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence == pos) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    ::new (cell.value()) T(std::move(value));
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // El CAS fallido dejó en pos el índice actual
+            } else if (sequence < pos) {
+                return false;   // La casilla todavía tiene el elemento de la vuelta anterior: cola llena
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Reserva la posición del frente si ya tiene un elemento; devuelve su casilla o nullptr si la cola está vacía
+    Cell *claim_front(size_t &pos) {
+        pos = dequeue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell &cell = cells[pos & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence == pos + 1) {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &cell;
+                }
+            } else if (sequence < pos + 1) {
+                return nullptr;   // Ningún productor terminó de escribir esta posición: cola vacía
+            } else {
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Destruye el elemento ya movido y libera la casilla para el productor de la vuelta siguiente
+    void release(Cell &cell, size_t pos) {
+        cell.value()->~T();
+        cell.sequence.store(pos + capacity, std::memory_order_release);
+    }
+
+public:
+    /**
+     * @brief Crea una cola con espacio para al menos "capacity" elementos (mínimo 2).
+     * @throws std::invalid_argument si capacity es 0.
+     */
+    explicit MpmcQueue(size_t capacity)
+        : capacity(std::max<size_t>(2, concurrent_detail::round_up_to_power_of_two(capacity))), mask(this->capacity - 1),
+          cells(new Cell[this->capacity]) {
+        for (size_t i = 0; i < this->capacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    ~MpmcQueue() {
+        for (size_t pos = dequeue_pos.load(); pos != enqueue_pos.load(); pos++) {
+            cells[pos & mask].value()->~T();
+        }
+    }
+
+    /**
+     * @brief Intenta agregar un elemento.
+     * @return false si la cola está llena.
+     */
+    bool try_enqueue(const T& value) {
+        T copy(value);
+        return push(std::move(copy));
+    }
+
+    bool try_enqueue(T&& value) {
+        return push(std::move(value));
+    }
+
+    /**
+     * @brief Agrega un elemento, esperando mientras la cola esté llena.
+     */
+    void enqueue(const T& value) {
+        T copy(value);
+        for (int spins = 0; !push(std::move(copy)); concurrent_detail::backoff(spins)) {}
+    }
+
+    void enqueue(T&& value) {
+        for (int spins = 0; !push(std::move(value)); concurrent_detail::backoff(spins)) {}
+    }
+
+    /**
+     * @brief Intenta quitar el elemento del frente. El elemento se mueve a "out".
+     * @return false si la cola está vacía.
+     */
+    bool try_dequeue(T& out) {
+        size_t pos;
+        Cell *cell = claim_front(pos);
+        if (cell == nullptr) {
+            return false;
+        }
+        out = std::move(*cell->value());
+        release(*cell, pos);
+        return true;
+    }
+
+    /**
+     * @brief Quita y devuelve el elemento del frente, esperando mientras la cola esté vacía.
+     */
+    T dequeue() {
+        size_t pos;
+        Cell *cell;
+        for (int spins = 0; (cell = claim_front(pos)) == nullptr; concurrent_detail::backoff(spins)) {}
+        T value = std::move(*cell->value());
+        release(*cell, pos);
+        return value;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Número aproximado de elementos (exacto solo si ningún otro hilo está usando la cola).
+     */
+    size_t size() const {
+        size_t d = dequeue_pos.load(std::memory_order_acquire);
+        size_t e = enqueue_pos.load(std::memory_order_acquire);
+        return e > d ? e - d : 0;
+    }
+};
+
+#endif // CONCURRENT_QUEUE_H
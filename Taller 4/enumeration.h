@@ -0,0 +1,255 @@
+#ifndef ENUMERATION_H
+#define ENUMERATION_H
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <mutex>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include "bit_queue.h"
+#include "classifier.h"
+#include "thread_pool.h"
+
+// Estadísticas de las cadenas de un largo
+struct LengthStats {
+    long long strings = 0;
+    long long loops = 0;
+    long long reused = 0;              // Cadenas resueltas con la tabla del largo anterior
+    long long max_halt_steps = -1;     // Máximo de pasos hasta quedar con menos de 3 bits
+    uint64_t max_halt_index = 0;
+    long long max_loop_start = -1;     // Máximo de pasos antes de entrar al ciclo
+    uint64_t max_loop_index = 0;
+};
+
+// Clasifica todas las cadenas binarias de largo 0 a max_length sin imprimir nada por cadena.
+// La cadena de largo L con índice m tiene en su posición i el bit i de m (el primer carácter es el bit 0).
+//
+// Cada paso cambia el largo de la cola en exactamente un bit (quita 3 y agrega 2 o 4), así que la trayectoria de una
+// cadena de largo L, mientras no entre en un ciclo, pasa por un estado de largo L - 1 apenas baja de L. Los largos se
+// procesan en orden creciente: la clasificación de ese estado ya está en la tabla del largo anterior y la cadena se
+// resuelve sin seguir simulando (la mitad de las cadenas, las que empiezan con 0, bajan en el primer paso). Si la
+// trayectoria nunca baja de L, el ciclo se detecta con el algoritmo de Brent comparando colas exactas.
+//
+// Además de la clasificación, para cada cadena se guarda cuántos pasos tarda en terminar (si no entra en bucle) o
+// cuántos pasos hay antes del ciclo (si entra); solo se conservan las tablas de los largos L - 1 y L.
+class ExhaustiveClassifier {
+private:
+    static constexpr int MAX_LENGTH = 28;
+    static constexpr uint64_t CHUNK_STRINGS = 4096;   // Cadenas por tarea (múltiplo de 8: cada tarea escribe sus bytes)
+
+    int max_length;
+    std::vector<std::vector<uint8_t>> bitmaps;   // bitmaps[L]: bit m = 1 si la cadena m de largo L entra en bucle
+    std::vector<LengthStats> stats;
+    std::vector<uint32_t> previous_steps;        // Pasos (terminar o llegar al ciclo) de cada cadena de largo L - 1
+    std::vector<uint32_t> current_steps;
+
+    bool bitmap_get(int length, uint64_t index) const {
+        return (bitmaps[length][index / 8] >> (index % 8)) & 1;
+    }
+
+    static uint32_t saturate(long long steps) {
+        return static_cast<uint32_t>(std::min<long long>(steps, UINT32_MAX));
+    }
+
+    static BitQueue queue_of(int length, uint64_t index) {
+        BitQueue q;
+        q.append_bits(index, length);
+        return q;
+    }
+
+    // Largo del ciclo que contiene a "start"
+    static long long cycle_length(const BitQueue &start) {
+        BitQueue q = start;
+        long long lambda = 0;
+        do {
+            apply_tag_rule(q);
+            lambda++;
+        } while (q != start);
+        return lambda;
+    }
+
+    // Pasos antes de entrar a un ciclo de largo lambda (segunda fase del algoritmo de Brent)
+    static long long cycle_start(const BitQueue &start, long long lambda) {
+        BitQueue tortoise = start;
+        BitQueue hare = start;
+        for (long long i = 0; i < lambda; i++) {
+            apply_tag_rule(hare);
+        }
+        long long mu = 0;
+        while (tortoise != hare) {
+            apply_tag_rule(tortoise);
+            apply_tag_rule(hare);
+            mu++;
+        }
+        return mu;
+    }
+
+    /**
+     * @brief Clasifica la cadena "index" de largo "length" (length >= 1, el largo anterior ya está resuelto).
+     * @param steps Recibe los pasos hasta terminar o hasta entrar al ciclo.
+     * @param reused Recibe true si se resolvió con la tabla del largo anterior.
+     * @return true si entra en bucle.
+     */
+    bool classify(int length, uint64_t index, long long &steps, bool &reused) const {
+        reused = false;
+        if (length < 3) {
+            steps = 0;
+            return false;
+        }
+        const BitQueue start = queue_of(length, index);
+        BitQueue q = start;
+        BitQueue tortoise = start;
+        long long power = 1;
+        long long lambda = 0;
+        for (long long k = 1; ; k++) {
+            apply_tag_rule(q);
+            lambda++;
+            if (q.size() < static_cast<size_t>(length)) {
+                // Estado de largo L - 1: su clasificación ya se conoce
+                uint64_t next = q.peek(length - 1);
+                bool next_loops = bitmap_get(length - 1, next);
+                long long next_steps = previous_steps[next];
+                reused = true;
+                if (!next_loops || next_steps > 0) {
+                    // Si termina, o si ese estado todavía no está en el ciclo, ningún estado anterior lo está
+                    steps = k + next_steps;
+                    return next_loops;
+                }
+                // El estado ya está en el ciclo; alguno de los k anteriores podría estarlo también
+                steps = cycle_start(start, cycle_length(q));
+                return true;
+            }
+            if (q == tortoise) {
+                steps = cycle_start(start, lambda);
+                return true;
+            }
+            if (power == lambda) {
+                tortoise = q;
+                power *= 2;
+                lambda = 0;
+            }
+        }
+    }
+
+    // Clasifica las cadenas [first, last) de largo "length" y suma sus estadísticas a las del largo
+    void classify_range(int length, uint64_t first, uint64_t last, std::mutex &stats_mutex) {
+        LengthStats local;
+        for (uint64_t index = first; index < last; index++) {
+            long long steps = 0;
+            bool reused = false;
+            bool loops = classify(length, index, steps, reused);
+            current_steps[index] = saturate(steps);
+            local.strings++;
+            local.reused += reused;
+            if (loops) {
+                bitmaps[length][index / 8] |= static_cast<uint8_t>(1 << (index % 8));
+                local.loops++;
+                if (steps > local.max_loop_start) {
+                    local.max_loop_start = steps;
+                    local.max_loop_index = index;
+                }
+            } else if (steps > local.max_halt_steps) {
+                local.max_halt_steps = steps;
+                local.max_halt_index = index;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(stats_mutex);
+        LengthStats &total = stats[length];
+        total.strings += local.strings;
+        total.loops += local.loops;
+        total.reused += local.reused;
+        // Ante empates se queda el índice menor, para que el resultado no dependa del orden de las tareas
+        if (local.max_halt_steps > total.max_halt_steps ||
+            (local.max_halt_steps == total.max_halt_steps && local.max_halt_index < total.max_halt_index)) {
+            total.max_halt_steps = local.max_halt_steps;
+            total.max_halt_index = local.max_halt_index;
+        }
+        if (local.max_loop_start > total.max_loop_start ||
+            (local.max_loop_start == total.max_loop_start && local.max_loop_index < total.max_loop_index)) {
+            total.max_loop_start = local.max_loop_start;
+            total.max_loop_index = local.max_loop_index;
+        }
+    }
+
+public:
+    /**
+     * @brief Prepara la clasificación de todas las cadenas de largo 0 a max_length.
+     * @throws std::invalid_argument si max_length no está entre 0 y 28.
+     */
+    explicit ExhaustiveClassifier(int max_length) : max_length(max_length) {
+        if (max_length < 0 || max_length > MAX_LENGTH) {
+            throw std::invalid_argument("Length must be between 0 and " + std::to_string(MAX_LENGTH));
+        }
+        for (int length = 0; length <= max_length; length++) {
+            bitmaps.emplace_back(((uint64_t(1) << length) + 7) / 8, 0);
+        }
+        stats.resize(max_length + 1);
+    }
+
+    /**
+     * @brief Clasifica todas las cadenas. Cada largo se reparte entre los hilos en bloques de CHUNK_STRINGS cadenas.
+     */
+    void run(int threads) {
+        ThreadPool pool(threads);
+        std::mutex stats_mutex;
+        for (int length = 0; length <= max_length; length++) {
+            uint64_t count = uint64_t(1) << length;
+            current_steps.assign(count, 0);
+            for (uint64_t first = 0; first < count; first += CHUNK_STRINGS) {
+                uint64_t last = std::min(count, first + CHUNK_STRINGS);
+                pool.submit([this, length, first, last, &stats_mutex] {
+                    classify_range(length, first, last, stats_mutex);
+                });
+            }
+            // El largo siguiente consulta este completo
+            pool.wait();
+            previous_steps.swap(current_steps);
+        }
+        previous_steps.clear();
+        previous_steps.shrink_to_fit();
+        current_steps.clear();
+        current_steps.shrink_to_fit();
+    }
+
+    int length() const {
+        return max_length;
+    }
+
+    /**
+     * @brief Indica si la cadena "index" de largo "length" entra en bucle (después de run).
+     */
+    bool loops(int length, uint64_t index) const {
+        return bitmap_get(length, index);
+    }
+
+    const LengthStats &length_stats(int length) const {
+        return stats[length];
+    }
+
+    /**
+     * @brief Escribe los bitmaps de todos los largos seguidos, del largo 0 al máximo. El de largo L ocupa
+     *        ceil(2^L / 8) bytes y el bit m (bit m % 8 del byte m / 8) es 1 si la cadena m entra en bucle.
+     * @throws std::runtime_error si no se puede escribir el archivo.
+     */
+    void write_bitmap(const std::string &path) const {
+        std::ofstream out(path, std::ios::binary);
+        for (const std::vector<uint8_t> &bitmap : bitmaps) {
+            out.write(reinterpret_cast<const char *>(bitmap.data()), static_cast<std::streamsize>(bitmap.size()));
+        }
+        if (!out) {
+            throw std::runtime_error("Could not write " + path);
+        }
+    }
+
+    /**
+     * @brief Cadena de '0' y '1' con el índice dado.
+     */
+    static std::string string_of(int length, uint64_t index) {
+        return queue_of(length, index).to_string();
+    }
+};
+
+#endif // ENUMERATION_H
@@ -1,94 +1,240 @@
 #include <iostream>
+#include <fstream>
+#include <iomanip>
 #include <string>
 #include <vector>
-#include <algorithm> // Para std::find
-#include "queue_list.h"
-
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <memory>
+#include <stdexcept>
+#include "classifier.h"
+#include "classification_memo.h"
+#include "thread_pool.h"
+#include "enumeration.h"
+
+// Uso:
+//   ./exercise4                       Lee un número binario de la entrada estándar y muestra su clasificación
+//   ./exercise4 --batch archivo [--threads N] [--output archivo] [--memo-entries M]
+//                                     Clasifica un número binario por línea del archivo con N hilos que comparten
+//                                     una tabla de estados ya resueltos (a lo sumo M huellas). Con --output escribe
+//                                     una clasificación por línea, en el orden de entrada ("invalid" si la línea no es
+//                                     un número binario). Al final muestra cadenas por segundo y aciertos de la tabla.
+//   ./exercise4 --enumerate N [--threads T] [--output archivo]
+//                                     Clasifica todas las cadenas de largo 0 a N (N <= 28) con T hilos, sin imprimir
+//                                     nada por cadena. Muestra, por largo, cuántas entran en bucle y las trayectorias
+//                                     más largas. Con --output escribe el bitmap de resultados (ver ExhaustiveClassifier).
+
+// Cantidad de líneas que clasifica cada tarea
+static const size_t CHUNK_LINES = 1024;
+
+// Resultados de las tareas que ya terminaron, para escribirlos en el orden de entrada
+struct BatchOutput {
+    std::ofstream *file = nullptr;
+    std::mutex mutex;
+    std::map<long long, std::string> finished;   // Número de bloque -> clasificaciones del bloque
+    long long next_chunk = 0;
+
+    void deliver(long long chunk, std::string text) {
+        if (file == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        finished.emplace(chunk, std::move(text));
+        while (!finished.empty() && finished.begin()->first == next_chunk) {
+            *file << finished.begin()->second;
+            finished.erase(finished.begin());
+            next_chunk++;
+        }
+    }
+};
 
-// Función helper para imprimir la Queue (copia)
-void print_queue(Queue<char> q) {
-    while (!q.empty()) {
-        std::cout << q.dequeue() << " ";
+static int run_batch(const std::string &input_path, int threads, const std::string &output_path, size_t memo_entries) {
+    std::ifstream input(input_path);
+    if (!input) {
+        std::cerr << "No se pudo abrir " << input_path << std::endl;
+        return 1;
+    }
+    std::ofstream output;
+    BatchOutput results;
+    if (!output_path.empty()) {
+        output.open(output_path);
+        if (!output) {
+            std::cerr << "No se pudo crear " << output_path << std::endl;
+            return 1;
+        }
+        results.file = &output;
     }
-    std::cout << std::endl;
-}
 
-// Función helper para convertir un string a una Queue
-Queue<char> make_queue_from_binary(const std::string &bin_str) {
-    Queue<char> q;
-    for (char c : bin_str) {
-        if (c == '0' || c == '1') {
-            q.enqueue(c);
-        } else {
-            throw std::invalid_argument("Invalid binary number");
+    ClassificationMemo memo(memo_entries);
+    std::mutex counts_mutex;
+    long long strings = 0, loops = 0, invalid = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        // Como mucho 2 bloques en espera por hilo: la lectura no se adelanta mucho a la clasificación
+        ThreadPool pool(threads, 2 * static_cast<size_t>(threads));
+        long long chunk = 0;
+        std::string line;
+        auto lines = std::make_shared<std::vector<std::string>>();
+        auto submit = [&]() {
+            pool.submit([&, lines, chunk]() {
+                std::string text;
+                long long chunk_loops = 0, chunk_invalid = 0;
+                for (const std::string &bin : *lines) {
+                    std::string classification;
+                    try {
+                        classification = binary_classifier_memo(bin, memo);
+                    } catch (const std::invalid_argument &) {
+                        classification = "invalid";
+                        chunk_invalid++;
+                    }
+                    chunk_loops += (classification == "1101");
+                    text += classification;
+                    text += '\n';
+                }
+                results.deliver(chunk, std::move(text));
+                std::lock_guard<std::mutex> lock(counts_mutex);
+                strings += static_cast<long long>(lines->size());
+                loops += chunk_loops;
+                invalid += chunk_invalid;
+            });
+            chunk++;
+            lines = std::make_shared<std::vector<std::string>>();
+        };
+
+        while (std::getline(input, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (line.empty()) {
+                continue;
+            }
+            lines->push_back(line);
+            if (lines->size() == CHUNK_LINES) {
+                submit();
+            }
         }
+        if (!lines->empty()) {
+            submit();
+        }
+        pool.wait();
     }
-    return q;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    long long lookups = 0, hits = 0;
+    memo.counters(lookups, hits);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Strings: " << strings << " (" << loops << " loops, " << invalid << " invalid) with "
+              << threads << " threads" << std::endl;
+    std::cout << "Time: " << seconds << " s, " << strings / seconds << " strings/s" << std::endl;
+    std::cout << "Memo: " << memo.size() << " states, " << hits << " hits of " << lookups << " lookups ("
+              << (lookups > 0 ? 100.0 * hits / lookups : 0.0) << "%), "
+              << (strings > 0 ? 100.0 * hits / strings : 0.0) << "% of strings resolved from the memo" << std::endl;
+    return 0;
 }
 
-// Función helper para convertir una Queue de enteros a un string
-std::string make_string_from_queue(Queue<char> q) {
-	std::string bin;
-	while (!q.empty()) {
-		bin += q.dequeue();
-	}
-	return bin;
-}
+static int run_enumeration(int max_length, int threads, const std::string &output_path) {
+    ExhaustiveClassifier classifier(max_length);
+    auto start = std::chrono::steady_clock::now();
+    classifier.run(threads);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::setw(6) << "length" << std::setw(12) << "strings" << std::setw(12) << "loops"
+              << std::setw(10) << "reused %" << std::setw(12) << "max halt" << std::setw(12) << "max start"
+              << "  (steps to halt / steps before the cycle)" << std::endl;
+    long long strings = 0, loops = 0, reused = 0;
+    for (int length = 0; length <= max_length; length++) {
+        const LengthStats &stats = classifier.length_stats(length);
+        strings += stats.strings;
+        loops += stats.loops;
+        reused += stats.reused;
+        std::cout << std::setw(6) << length << std::setw(12) << stats.strings << std::setw(12) << stats.loops
+                  << std::setw(10) << std::fixed << std::setprecision(1) << 100.0 * stats.reused / stats.strings
+                  << std::setw(12) << stats.max_halt_steps << std::setw(12) << stats.max_loop_start << std::endl;
+    }
 
-// Función de clasificación. Clasifica 00 a aquellos que con las reglas no entran en un bucle, y con 1101 a aquellos que resultan en un bucle.
-std::string binary_classifier(std::string &bin) {
-    Queue<char> q = make_queue_from_binary(bin);
-	std::vector<std::string> seen; // Vector para almacenar estados de la cola. Si se vuelve a un estado después de haber aplicado las reglas, se considera un bucle.
-
-    // Imprimir la cola inicial
-    std::cout << "Initial queue: ";
-    print_queue(q);
-
-    // Mientras haya al menos 3 bits en la cola
-    while (q.size() >= 3) {
-		// Comprobar si el estado actual ya ha sido visitado
-		if (std::find(seen.begin(), seen.end(), make_string_from_queue(q)) != seen.end()) {
-			std::cout << "Loop found at: ";
-            print_queue(q);
-            std::cout << std::endl;
-			return "1101";
-		}
-		seen.push_back(make_string_from_queue(q));
-
-
-        char front = q.front();  // Obtener el primer bit
-
-        // Eliminar los primeros 3 bits
-        q.dequeue();
-        q.dequeue();
-        q.dequeue();
-
-        // Añadir bits según la regla
-        if (front == '0') {
-            q.enqueue('0');
-            q.enqueue('0');
-        } else if (front == '1') {
-            q.enqueue('1');
-            q.enqueue('1');
-            q.enqueue('0');
-            q.enqueue('1');
-        }
+    // Trayectorias más largas del largo máximo
+    const LengthStats &last = classifier.length_stats(max_length);
+    if (last.max_halt_steps > 0) {
+        std::cout << "Longest halting run: " << ExhaustiveClassifier::string_of(max_length, last.max_halt_index)
+                  << " (" << last.max_halt_steps << " steps)" << std::endl;
+    }
+    if (last.max_loop_start >= 0) {
+        std::cout << "Longest path into a loop: " << ExhaustiveClassifier::string_of(max_length, last.max_loop_index)
+                  << " (" << last.max_loop_start << " steps)" << std::endl;
     }
+    std::cout << std::setprecision(2);
+    std::cout << "Total: " << strings << " strings, " << loops << " loops, " << reused << " resolved from the previous"
+              << " length, " << seconds << " s with " << threads << " threads" << std::endl;
 
-	// En este punto la cadena no entró en un bucle, por lo tanto, su última iteración fue de la forma 0xx y su clasificación es 00
-	return "00";
+    if (!output_path.empty()) {
+        classifier.write_bitmap(output_path);
+        std::cout << "Bitmap written to " << output_path << std::endl;
+    }
+    return 0;
 }
 
-int main() {
-    std::string bin;
-    std::cout << "Enter a binary number: ";
-    std::cin >> bin;
+int main(int argc, char *argv[]) {
+    if (argc == 1) {
+        std::string bin;
+        std::cout << "Enter a binary number: ";
+        std::cin >> bin;
 
-    // Llamar al clasificador binario
-    std::string classification = binary_classifier(bin);
+        // Llamar al clasificador binario
+        std::string classification = binary_classifier(bin);
 
-    // Imprimir el resultado
-    std::cout << "Classification: " << classification << std::endl;
+        // Imprimir el resultado
+        std::cout << "Classification: " << classification << std::endl;
 
-    return 0;
+        return 0;
+    }
+
+    std::string input_path;
+    std::string output_path;
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    size_t memo_entries = size_t(1) << 21;
+    int enumerate_length = -1;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << arg << std::endl;
+            return 1;
+        }
+        if (arg == "--batch") {
+            input_path = argv[++i];
+        } else if (arg == "--enumerate") {
+            enumerate_length = std::stoi(argv[++i]);
+        } else if (arg == "--threads") {
+            threads = std::stoi(argv[++i]);
+        } else if (arg == "--output") {
+            output_path = argv[++i];
+        } else if (arg == "--memo-entries") {
+            memo_entries = std::stoull(argv[++i]);
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (input_path.empty() == (enumerate_length < 0)) {
+        std::cerr << "Indique --batch archivo o --enumerate N" << std::endl;
+        return 1;
+    }
+    if (threads < 1) {
+        std::cerr << "--threads debe ser al menos 1" << std::endl;
+        return 1;
+    }
+
+    if (enumerate_length >= 0) {
+        try {
+            return run_enumeration(enumerate_length, threads, output_path);
+        } catch (const std::exception &e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    return run_batch(input_path, threads, output_path, memo_entries);
 }
@@ -0,0 +1,142 @@
+#ifndef MACRO_STEP_H
+#define MACRO_STEP_H
+
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include "bit_queue.h"
+#include "state_fingerprint.h"
+#include "classifier.h"
+
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
+// Tabla de macro-pasos de la regla (quitar 3 bits; agregar 00 si el primero era 0 y 1101 si era 1).
+// Cada paso solo mira el bit del frente, así que con los primeros k bits de la cola quedan determinados los
+// siguientes m = floor((k - 1) / 3) + 1 pasos (sus bits del frente son los bits 0, 3, ..., 3(m - 1)), siempre que la
+// cola tenga al menos 3m bits: ninguno de esos pasos llega a leer un bit agregado. Como los otros bits del prefijo no
+// influyen, la tabla se indexa solo con esos m bits (2^m entradas, 1 KB con k = 20 en lugar de 8 MB) y guarda los
+// bits que agregan los m pasos; se consumen siempre 3m bits.
+class MacroStepTable {
+private:
+    int prefix_bits;
+    int macro_steps;
+    uint64_t front_mask;             // Bits 0, 3, ..., 3(m - 1)
+    std::vector<uint64_t> entries;   // (bits agregados << 8) | cantidad de bits agregados
+    std::vector<uint8_t> gather;     // Bits 0, 3, 6 y 9 de cada valor de 12 bits, juntos (sin BMI2)
+
+    /**
+     * @brief Junta los bits del frente de los m pasos (bits 0, 3, ..., 3(m - 1) de "chunk") en los bits 0 ... m - 1.
+     *        Con BMI2 es una sola instrucción (pext); si no, dos consultas a "gather", porque con m <= 7 los bits están
+     *        en los primeros 24.
+     */
+    uint64_t front_bits(uint64_t chunk) const {
+#ifdef __BMI2__
+        return _pext_u64(chunk, front_mask);
+#else
+        chunk &= front_mask;
+        return gather[chunk & 0xFFF] | (uint64_t(gather[(chunk >> 12) & 0xFFF]) << 4);
+#endif
+    }
+
+public:
+    /**
+     * @brief Construye la tabla para prefijos de k bits (2^m entradas, m = floor((k - 1) / 3) + 1).
+     * @throws std::invalid_argument si k no está entre 1 y 20.
+     */
+    explicit MacroStepTable(int k) : prefix_bits(k), macro_steps((k - 1) / 3 + 1), front_mask(0) {
+        if (k < 1 || k > 20) {
+            throw std::invalid_argument("Prefix length must be between 1 and 20 bits");
+        }
+        for (int i = 0; i < macro_steps; i++) {
+            front_mask |= uint64_t(1) << (3 * i);
+        }
+        gather.resize(4096);
+        for (uint64_t chunk = 0; chunk < gather.size(); chunk++) {
+            for (int i = 0; i < 4; i++) {
+                gather[chunk] |= static_cast<uint8_t>(((chunk >> (3 * i)) & 1) << i);
+            }
+        }
+        entries.resize(size_t(1) << macro_steps);
+        for (uint64_t fronts = 0; fronts < entries.size(); fronts++) {
+            uint64_t out = 0;
+            int length = 0;
+            for (int i = 0; i < macro_steps; i++) {
+                uint64_t front = (fronts >> i) & 1;
+                out |= (front * 0b1011) << length;
+                length += 2 + 2 * static_cast<int>(front);
+            }
+            entries[fronts] = (out << 8) | static_cast<uint64_t>(length);
+        }
+    }
+
+    int prefix_length() const {
+        return prefix_bits;
+    }
+
+    /**
+     * @brief Cantidad de pasos que avanza cada consulta a la tabla.
+     */
+    int steps() const {
+        return macro_steps;
+    }
+
+    /**
+     * @brief Aplica hasta max_steps pasos de la regla (se detiene antes si quedan menos de 3 bits) y devuelve cuántos
+     *        aplicó. Deja la cola igual que apply_tag_rule aplicado paso a paso.
+     *        Mientras la cola tenga bits suficientes, lee de una vez una ventana con todas las consultas que caben en
+     *        63 bits y las hace seguidas; los bits agregados se juntan en una palabra antes de escribirlos.
+     *        Si se pasa una huella, se actualiza junto con la cola.
+     */
+    long long advance(BitQueue &q, long long max_steps, StateFingerprint *fingerprint = nullptr) const {
+        const int consumed = 3 * macro_steps;
+        const int lookups = 63 / consumed;               // Consultas por ventana
+        const int window_bits = lookups * consumed;
+        const long long window_steps = static_cast<long long>(lookups) * macro_steps;
+        const int max_out = 4 * macro_steps;             // Máximo de bits que agrega una consulta
+        long long done = 0;
+
+        while (done < max_steps && q.size() >= 3) {
+            // Cola más corta que la ventana o pocos pasos por hacer: una consulta, o un paso a la vez si no alcanza
+            int count = lookups;
+            if (q.size() < static_cast<size_t>(window_bits) || max_steps - done < window_steps) {
+                if (q.size() < static_cast<size_t>(consumed) || max_steps - done < macro_steps) {
+                    apply_tag_rule(q, fingerprint);
+                    done++;
+                    continue;
+                }
+                count = 1;
+            }
+
+            uint64_t window = q.peek(count * consumed);
+            q.pop_front(count * consumed);
+            if (fingerprint != nullptr) {
+                fingerprint->pop_front(window, count * consumed);
+            }
+            uint64_t out = 0;
+            int length = 0;
+            for (int j = 0; j < count; j++) {
+                if (length + max_out > 64) {
+                    q.append_bits(out, length);
+                    if (fingerprint != nullptr) {
+                        fingerprint->append_bits(out, length);
+                    }
+                    out = 0;
+                    length = 0;
+                }
+                uint64_t entry = entries[front_bits(window >> (j * consumed))];
+                out |= (entry >> 8) << length;
+                length += static_cast<int>(entry & 0xFF);
+            }
+            q.append_bits(out, length);
+            if (fingerprint != nullptr) {
+                fingerprint->append_bits(out, length);
+            }
+            done += static_cast<long long>(count) * macro_steps;
+        }
+        return done;
+    }
+};
+
+#endif // MACRO_STEP_H
@@ -0,0 +1,325 @@
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <initializer_list>
+#include <utility>
+#include <cstddef>
+
+// Cola de prioridad con la interfaz de Queue (enqueue, dequeue, front, size, empty). Como std::priority_queue, con
+// Compare = std::less<T> el frente es el elemento mayor; con std::greater<T>, el menor.
+//
+// Es un montículo de Arity hijos por nodo guardado en un vector contiguo: el nodo i tiene sus hijos en
+// Arity * i + 1 ... Arity * i + Arity. Con Arity = 4 el árbol tiene la mitad de niveles que un montículo binario y los
+// cuatro hijos que se comparan al bajar están seguidos en memoria. Al subir y bajar un elemento se corre el "hueco" en
+// lugar de intercambiar en cada nivel, y dequeue baja el hueco hasta una hoja sin comparar con el último elemento (que
+// casi siempre vuelve cerca del fondo) y recién ahí lo sube.
+//
+// Para decrease-key, enqueue_tracked devuelve un Handle con el que update cambia la prioridad del elemento en
+// O(log n) sin buscarlo. Llevar la posición de cada Handle cuesta una escritura más por nivel, así que la cola recién
+// empieza a hacerlo con el primer enqueue_tracked; mientras solo se use enqueue no hay costo extra.
+template<class T, class Compare = std::less<T>, size_t Arity = 4>
+class PriorityQueue {
+    static_assert(Arity >= 2, "PriorityQueue necesita al menos dos hijos por nodo");
+
+public:
+    using Handle = size_t;
+
+private:
+    static constexpr size_t NONE = static_cast<size_t>(-1);
+
+    std::vector<T> heap;
+    std::vector<Handle> handles;      // Handle de cada elemento de heap (NONE si no tiene); vacío hasta el primer
+                                      // enqueue_tracked
+    std::vector<size_t> position;     // Posición en heap de cada Handle, o NONE si ya salió de la cola
+    std::vector<Handle> free_handles;
+    bool tracking = false;
+    Compare compare;
+
+    // true si a debe estar más cerca del frente que b
+    bool before(const T &a, const T &b) const {
+        return compare(b, a);
+    }
+
+    // Mueve el elemento de "from" al hueco "index"
+    void fill(size_t index, size_t from) {
+        heap[index] = std::move(heap[from]);
+        if (tracking) {
+            handles[index] = handles[from];
+            if (handles[index] != NONE) {
+                position[handles[index]] = index;
+            }
+        }
+    }
+
+    void put(size_t index, T &&value, Handle handle) {
+        heap[index] = std::move(value);
+        if (tracking) {
+            handles[index] = handle;
+            if (handle != NONE) {
+                position[handle] = index;
+            }
+        }
+    }
+
+    // Sube "value" desde el hueco "index"
+    void sift_up(size_t index, T value, Handle handle) {
+        while (index > 0) {
+            size_t parent = (index - 1) / Arity;
+            if (!before(value, heap[parent])) {
+                break;
+            }
+            fill(index, parent);
+            index = parent;
+        }
+        put(index, std::move(value), handle);
+    }
+
+    // Sube el elemento recién agregado al final. Se saca de su casilla, que queda como hueco, así T no necesita
+    // constructor por defecto
+    void sift_up_back(Handle handle) {
+        size_t index = heap.size() - 1;
+        sift_up(index, std::move(heap[index]), handle);
+    }
+
+    size_t best_child(size_t first, size_t count) const {
+        size_t last = first + Arity < count ? first + Arity : count;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (before(heap[child], heap[best])) {
+                best = child;
+            }
+        }
+        return best;
+    }
+
+    // Baja "value" desde el hueco "index"
+    void sift_down(size_t index, T value, Handle handle) {
+        size_t count = heap.size();
+        for (size_t first = Arity * index + 1; first < count; first = Arity * index + 1) {
+            size_t best = best_child(first, count);
+            if (!before(heap[best], value)) {
+                break;
+            }
+            fill(index, best);
+            index = best;
+        }
+        put(index, std::move(value), handle);
+    }
+
+    Handle handle_at(size_t index) const {
+        return tracking ? handles[index] : NONE;
+    }
+
+    // Quita el frente, que ya fue movido afuera: baja el hueco hasta una hoja y ubica ahí el último elemento
+    void remove_front() {
+        if (tracking) {
+            release(handles.front());
+        }
+        size_t count = heap.size() - 1;
+        size_t index = 0;
+        for (size_t first = 1; first < count; first = Arity * index + 1) {
+            size_t best = best_child(first, count);
+            fill(index, best);
+            index = best;
+        }
+        if (index != count) {
+            Handle handle = handle_at(count);
+            sift_up(index, std::move(heap.back()), handle);
+        }
+        heap.pop_back();
+        if (tracking) {
+            handles.pop_back();
+        }
+    }
+
+    void release(Handle handle) {
+        if (handle != NONE) {
+            position[handle] = NONE;
+            free_handles.push_back(handle);
+        }
+    }
+
+    void check_handle(Handle handle) const {
+        if (!contains(handle)) {
+            throw std::out_of_range("El handle no corresponde a ningún elemento de la cola.");
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor por defecto. Crea una cola vacía.
+     * @param compare Criterio de orden (el frente es el mayor según compare).
+     */
+    explicit PriorityQueue(const Compare &compare = Compare()) : compare(compare) {}
+
+    /**
+     * @brief Crea la cola con los elementos de [first, last) en O(n) (heapify de abajo hacia arriba) en lugar de
+     *        O(n log n) con n enqueue. Estos elementos no tienen Handle.
+     * @param first Iterador al primer elemento.
+     * @param last Iterador después del último elemento.
+     * @param compare Criterio de orden.
+     */
+    template<class InputIt>
+    PriorityQueue(InputIt first, InputIt last, const Compare &compare = Compare()) : heap(first, last),
+                                                                                     compare(compare) {
+        // Los nodos con hijos son los de índice menor o igual que el padre del último
+        for (size_t i = heap.size() > 1 ? (heap.size() - 2) / Arity + 1 : 0; i-- > 0;) {
+            sift_down(i, std::move(heap[i]), NONE);
+        }
+    }
+
+    /**
+     * @brief Constructor que inicializa la cola con una lista de inicialización (en O(n), como el de rango).
+     * @param init Lista de inicialización de elementos.
+     */
+    PriorityQueue(std::initializer_list<T> init) : PriorityQueue(init.begin(), init.end()) {}
+
+    /**
+     * @brief Verifica si la cola está vacía.
+     * @return true si la cola está vacía, false en caso contrario.
+     */
+    bool empty() const {
+        return heap.empty();
+    }
+
+    /**
+     * @brief Obtiene el número de elementos en la cola.
+     * @return El número de elementos en la cola.
+     */
+    int size() const {
+        return static_cast<int>(heap.size());
+    }
+
+    /**
+     * @brief Reserva espacio para n elementos.
+     */
+    void reserve(size_t n) {
+        heap.reserve(n);
+        if (tracking) {
+            handles.reserve(n);
+        }
+    }
+
+    /**
+     * @brief Devuelve el elemento de mayor prioridad. Es constante: para cambiar su prioridad se usa update.
+     * @return Referencia al elemento en el frente de la cola.
+     * @throws std::out_of_range si la cola está vacía.
+     */
+    const T& front() const {
+        if (empty()) {
+            throw std::out_of_range("La cola está vacía. No se puede acceder al elemento en front.");
+        }
+        return heap.front();
+    }
+
+    /**
+     * @brief Inserta un nuevo elemento en la cola.
+     * @param value El valor que se va a insertar.
+     */
+    void enqueue(const T& value) {
+        enqueue(T(value));
+    }
+
+    /**
+     * @brief Inserta un nuevo elemento movido en la cola.
+     * @param value El valor que se va a mover a la cola.
+     */
+    void enqueue(T&& value) {
+        heap.push_back(std::move(value));
+        if (tracking) {
+            handles.push_back(NONE);
+        }
+        sift_up_back(NONE);
+    }
+
+    /**
+     * @brief Inserta un nuevo elemento y devuelve un Handle para consultarlo o cambiar su prioridad con update
+     *        mientras esté en la cola. Cuando el elemento sale de la cola, su Handle puede reutilizarse.
+     * @param value El valor que se va a insertar.
+     * @return Handle del elemento.
+     */
+    Handle enqueue_tracked(T value) {
+        if (!tracking) {
+            tracking = true;
+            handles.assign(heap.size(), NONE);
+        }
+        Handle handle;
+        if (!free_handles.empty()) {
+            handle = free_handles.back();
+            free_handles.pop_back();
+        } else {
+            handle = position.size();
+            position.push_back(NONE);
+        }
+        heap.push_back(std::move(value));
+        handles.push_back(NONE);
+        sift_up_back(handle);
+        return handle;
+    }
+
+    /**
+     * @brief Elimina y devuelve el elemento de mayor prioridad. El elemento se mueve, no se copia.
+     * @return T El valor del elemento eliminado de la cola.
+     * @throws std::out_of_range si la cola está vacía.
+     */
+    T dequeue() {
+        if (empty()) {
+            throw std::out_of_range("La cola está vacía. No se puede eliminar ningún elemento.");
+        }
+        T value = std::move(heap.front());
+        remove_front();
+        return value;
+    }
+
+    /**
+     * @brief Intenta eliminar el elemento de mayor prioridad sin lanzar excepciones.
+     * @param out Variable donde se mueve el elemento eliminado.
+     * @return true si se eliminó un elemento, false si la cola estaba vacía.
+     */
+    bool try_dequeue(T& out) {
+        if (empty()) {
+            return false;
+        }
+        out = std::move(heap.front());
+        remove_front();
+        return true;
+    }
+
+    /**
+     * @brief Indica si el elemento de ese Handle sigue en la cola.
+     */
+    bool contains(Handle handle) const {
+        return handle < position.size() && position[handle] != NONE;
+    }
+
+    /**
+     * @brief Devuelve el valor actual del elemento de ese Handle.
+     * @throws std::out_of_range si el elemento ya no está en la cola.
+     */
+    const T& value(Handle handle) const {
+        check_handle(handle);
+        return heap[position[handle]];
+    }
+
+    /**
+     * @brief Reemplaza el valor del elemento de ese Handle y lo reubica. Si el nuevo valor tiene más prioridad es el
+     *        decrease-key de Dijkstra (el elemento sube); si tiene menos, el elemento baja.
+     * @param handle Handle devuelto por enqueue_tracked.
+     * @param value Nuevo valor.
+     * @throws std::out_of_range si el elemento ya no está en la cola.
+     */
+    void update(Handle handle, T value) {
+        check_handle(handle);
+        size_t index = position[handle];
+        if (before(value, heap[index])) {
+            sift_up(index, std::move(value), handle);
+        } else {
+            sift_down(index, std::move(value), handle);
+        }
+    }
+};
+
+#endif // PRIORITY_QUEUE_H
@@ -4,12 +4,24 @@
 #include <list>
 #include <stdexcept>
 #include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "ring_buffer.h"
 
-// Clase Queue que utiliza std::list como contenedor subyacente
-template<class T>
+// Indica si un contenedor tiene reserve(n), para reservar de una vez en enqueue_range
+template<class C, class = void>
+struct has_reserve : std::false_type {};
+
+template<class C>
+struct has_reserve<C, std::void_t<decltype(std::declval<C&>().reserve(size_t()))>> : std::true_type {};
+
+// Clase Queue que permite elegir el contenedor subyacente (necesita push_back, pop_front, front, back, empty y size).
+// Por defecto usa RingBuffer, que no reserva memoria por cada elemento como std::list
+template<class T, template<typename, typename...> class Container = RingBuffer>
 class Queue {
 private:
-    std::list<T> queueContainer;   // Contenedor std::list para almacenar los elementos de la cola
+    Container<T> queueContainer;   // Contenedor genérico, por defecto RingBuffer
 
 public:
     /**
@@ -116,7 +128,23 @@ public:
     }
 
     /**
-     * @brief Elimina y devuelve el elemento en la parte frontal de la cola.
+     * @brief Inserta en la parte trasera todos los elementos de [first, last) en orden.
+     * @param first Iterador al primer elemento a insertar.
+     * @param last Iterador después del último elemento a insertar.
+     */
+    template<class InputIt>
+    void enqueue_range(InputIt first, InputIt last) {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (has_reserve<Container<T>>::value && std::is_base_of<std::forward_iterator_tag, Category>::value) {
+            queueContainer.reserve(queueContainer.size() + std::distance(first, last));
+        }
+        for (; first != last; ++first) {
+            queueContainer.push_back(*first);
+        }
+    }
+
+    /**
+     * @brief Elimina y devuelve el elemento en la parte frontal de la cola. El elemento se mueve, no se copia.
      * @return T El valor del elemento eliminado de la cola.
      * @throws std::out_of_range si la cola está vacía.
      */
@@ -124,10 +152,41 @@ public:
         if (empty()) {
             throw std::out_of_range("La cola está vacía. No se puede eliminar ningún elemento.");
         }
-        T value = queueContainer.front();
+        T value = std::move(queueContainer.front());
         queueContainer.pop_front();
         return value;
     }
+
+    /**
+     * @brief Intenta eliminar el elemento en la parte frontal de la cola sin lanzar excepciones.
+     * @param out Variable donde se mueve el elemento eliminado.
+     * @return true si se eliminó un elemento, false si la cola estaba vacía.
+     */
+    bool try_dequeue(T& out) {
+        if (empty()) {
+            return false;
+        }
+        out = std::move(queueContainer.front());
+        queueContainer.pop_front();
+        return true;
+    }
+
+    /**
+     * @brief Elimina hasta n elementos del frente y los escribe (movidos) en "out", en orden.
+     * @param n Número máximo de elementos a eliminar.
+     * @param out Iterador de salida donde se escriben los elementos.
+     * @return El número de elementos eliminados (menor que n si la cola tenía menos).
+     */
+    template<class OutputIt>
+    int dequeue_n(int n, OutputIt out) {
+        int removed = 0;
+        while (removed < n && !queueContainer.empty()) {
+            *out++ = std::move(queueContainer.front());
+            queueContainer.pop_front();
+            removed++;
+        }
+        return removed;
+    }
 };
 
 #endif // QUEUE_LIST_H
@@ -0,0 +1,242 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <algorithm>
+#include <initializer_list>
+
+// Buffer circular que crece duplicando su capacidad (siempre potencia de dos, así el índice se calcula con una máscara).
+// Los elementos viven en un único bloque contiguo: insertar al final y quitar del frente no reservan ni liberan memoria,
+// salvo cuando hay que crecer. Ofrece la parte de la interfaz de std::list/std::deque que usa Queue.
+template<class T>
+class RingBuffer {
+private:
+    T *slots = nullptr;      // Memoria sin inicializar; los elementos válidos están en [head, head + count) módulo capacity
+    size_t capacity = 0;
+    size_t head = 0;
+    size_t count = 0;
+
+    T *slot(size_t i) const {
+        return slots + ((head + i) & (capacity - 1));
+    }
+
+    static T *allocate(size_t capacity) {
+        return static_cast<T *>(::operator new(capacity * sizeof(T)));
+    }
+
+    /**
+     * @brief Construye los elementos en "bigger" desde la casilla 0, moviéndolos si moverlos no lanza y copiándolos si
+     *        no. Si un constructor lanza, destruye lo ya construido y los elementos originales quedan intactos.
+     */
+    void transfer_to(T *bigger) {
+        size_t i = 0;
+        try {
+            for (; i < count; i++) {
+                ::new (bigger + i) T(std::move_if_noexcept(*slot(i)));
+            }
+        } catch (...) {
+            while (i > 0) {
+                bigger[--i].~T();
+            }
+            throw;
+        }
+    }
+
+    /**
+     * @brief Destruye los elementos originales (ya transferidos) y pasa a usar el bloque "bigger".
+     */
+    void adopt(T *bigger, size_t new_capacity) {
+        for (size_t i = 0; i < count; i++) {
+            slot(i)->~T();
+        }
+        ::operator delete(slots);
+        slots = bigger;
+        capacity = new_capacity;
+        head = 0;
+    }
+
+    /**
+     * @brief Mueve los elementos a un bloque nuevo de "new_capacity" casillas, dejándolos desde la casilla 0. Si un
+     *        constructor lanza, libera el bloque nuevo y el buffer queda como estaba.
+     */
+    void reallocate(size_t new_capacity) {
+        T *bigger = allocate(new_capacity);
+        try {
+            transfer_to(bigger);
+        } catch (...) {
+            ::operator delete(bigger);
+            throw;
+        }
+        adopt(bigger, new_capacity);
+    }
+
+public:
+    /**
+     * @brief Constructor por defecto. Crea un buffer vacío sin reservar memoria.
+     */
+    RingBuffer() = default;
+
+    /**
+     * @brief Constructor que inicializa el buffer con una lista de inicialización.
+     * @param init Lista de inicialización de elementos.
+     */
+    RingBuffer(std::initializer_list<T> init) {
+        reserve(init.size());
+        for (const T& value : init) {
+            push_back(value);
+        }
+    }
+
+    /**
+     * @brief Constructor por copia.
+     * @param other Otro buffer del cual copiar los elementos.
+     */
+    RingBuffer(const RingBuffer& other) {
+        reserve(other.count);
+        for (size_t i = 0; i < other.count; i++) {
+            push_back(*other.slot(i));
+        }
+    }
+
+    /**
+     * @brief Constructor por movimiento. Toma el bloque de memoria del otro buffer.
+     * @param other Otro buffer desde el cual mover los elementos.
+     */
+    RingBuffer(RingBuffer&& other) noexcept
+        : slots(std::exchange(other.slots, nullptr)), capacity(std::exchange(other.capacity, 0)),
+          head(std::exchange(other.head, 0)), count(std::exchange(other.count, 0)) {}
+
+    /**
+     * @brief Operador de asignación por copia.
+     */
+    RingBuffer& operator=(const RingBuffer& other) {
+        if (this != &other) {
+            RingBuffer copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Operador de asignación por movimiento.
+     */
+    RingBuffer& operator=(RingBuffer&& other) noexcept {
+        if (this != &other) {
+            RingBuffer moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    ~RingBuffer() {
+        clear();
+        ::operator delete(slots);
+    }
+
+    void swap(RingBuffer& other) noexcept {
+        std::swap(slots, other.slots);
+        std::swap(capacity, other.capacity);
+        std::swap(head, other.head);
+        std::swap(count, other.count);
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * @brief Reserva espacio para al menos n elementos (redondeado a potencia de dos).
+     */
+    void reserve(size_t n) {
+        if (n <= capacity) {
+            return;
+        }
+        size_t new_capacity = std::max<size_t>(capacity, 16);
+        while (new_capacity < n) {
+            new_capacity *= 2;
+        }
+        reallocate(new_capacity);
+    }
+
+    T& front() {
+        return *slot(0);
+    }
+
+    const T& front() const {
+        return *slot(0);
+    }
+
+    T& back() {
+        return *slot(count - 1);
+    }
+
+    const T& back() const {
+        return *slot(count - 1);
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template<class... Args>
+    T& emplace_back(Args&&... args) {
+        if (count < capacity) {
+            T *place = slot(count);
+            ::new (place) T(std::forward<Args>(args)...);
+            count++;
+            return *place;
+        }
+        // Lleno: el elemento nuevo se construye primero, directamente en el bloque nuevo, porque los argumentos pueden
+        // referirse a un elemento del propio buffer (por ejemplo push_back(front())) que luego se mueve y se destruye
+        size_t new_capacity = capacity == 0 ? 16 : capacity * 2;
+        T *bigger = allocate(new_capacity);
+        T *place = bigger + count;
+        try {
+            ::new (place) T(std::forward<Args>(args)...);
+        } catch (...) {
+            ::operator delete(bigger);
+            throw;
+        }
+        try {
+            transfer_to(bigger);
+        } catch (...) {
+            place->~T();
+            ::operator delete(bigger);
+            throw;
+        }
+        adopt(bigger, new_capacity);
+        count++;
+        return *place;
+    }
+
+    /**
+     * @brief Destruye el primer elemento (el buffer no debe estar vacío).
+     */
+    void pop_front() {
+        slot(0)->~T();
+        head = (head + 1) & (capacity - 1);
+        count--;
+    }
+
+    /**
+     * @brief Destruye todos los elementos conservando la memoria reservada.
+     */
+    void clear() {
+        while (count > 0) {
+            pop_front();
+        }
+        head = 0;
+    }
+};
+
+#endif // RING_BUFFER_H
@@ -0,0 +1,258 @@
+#ifndef SMALL_STACK_H
+#define SMALL_STACK_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <initializer_list>
+
+// Pila con capacidad para N elementos dentro del propio objeto: mientras no pase de N elementos no reserva memoria
+// dinámica, así que una pila de vida corta (por ejemplo, la de un DFS dentro de un ciclo) no paga una reserva por uso.
+// Si se llena, los elementos pasan a un bloque dinámico que crece duplicando; el bloque se conserva hasta destruir la
+// pila. Ofrece la interfaz de Stack, y además emplace y pop_n; pop mueve el elemento en lugar de copiarlo.
+template<class T, size_t N = 16>
+class SmallStack {
+    static_assert(N > 0, "SmallStack necesita capacidad interna");
+
+private:
+    alignas(T) unsigned char inline_slots[N * sizeof(T)];
+    T *slots = reinterpret_cast<T *>(inline_slots);   // Apunta a inline_slots o al bloque dinámico
+    size_t count = 0;
+    size_t capacity = N;
+
+    bool on_heap() const {
+        return slots != reinterpret_cast<const T *>(inline_slots);
+    }
+
+    // Primero construye todos los elementos en el bloque nuevo y solo después destruye los originales: si una copia
+    // lanza, se deshace lo construido y la pila queda como estaba
+    void grow() {
+        size_t new_capacity = capacity * 2;
+        T *bigger = static_cast<T *>(::operator new(new_capacity * sizeof(T)));
+        size_t i = 0;
+        try {
+            for (; i < count; i++) {
+                ::new (bigger + i) T(std::move_if_noexcept(slots[i]));
+            }
+        } catch (...) {
+            while (i > 0) {
+                bigger[--i].~T();
+            }
+            ::operator delete(bigger);
+            throw;
+        }
+        for (i = 0; i < count; i++) {
+            slots[i].~T();
+        }
+        release_heap();
+        slots = bigger;
+        capacity = new_capacity;
+    }
+
+    void release_heap() {
+        if (on_heap()) {
+            ::operator delete(slots);
+        }
+    }
+
+    void destroy_all() {
+        while (count > 0) {
+            slots[--count].~T();
+        }
+    }
+
+    // Toma los elementos de otra pila: el bloque dinámico si lo tiene, o moviéndolos uno a uno si están en su interior
+    void take(SmallStack &other) noexcept {
+        if (other.on_heap()) {
+            slots = other.slots;
+            capacity = other.capacity;
+            count = other.count;
+            other.slots = reinterpret_cast<T *>(other.inline_slots);
+            other.capacity = N;
+            other.count = 0;
+        } else {
+            for (size_t i = 0; i < other.count; i++) {
+                ::new (slots + i) T(std::move(other.slots[i]));
+            }
+            count = other.count;
+            other.destroy_all();
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor por defecto. Crea una pila vacía sin reservar memoria.
+     */
+    SmallStack() = default;
+
+    /**
+     * @brief Constructor que inicializa la pila con una lista de inicialización (el último elemento queda en la cima).
+     * @param init Lista de inicialización de elementos.
+     */
+    SmallStack(std::initializer_list<T> init) {
+        for (const T& value : init) {
+            push(value);
+        }
+    }
+
+    /**
+     * @brief Constructor por copia.
+     * @param other Otra pila de la cual copiar los elementos.
+     */
+    SmallStack(const SmallStack& other) {
+        for (size_t i = 0; i < other.count; i++) {
+            push(other.slots[i]);
+        }
+    }
+
+    /**
+     * @brief Constructor por movimiento. Si la otra pila usa memoria dinámica, se queda con su bloque.
+     * @param other Otra pila desde la cual mover los elementos.
+     */
+    SmallStack(SmallStack&& other) noexcept {
+        take(other);
+    }
+
+    /**
+     * @brief Operador de asignación por copia.
+     */
+    SmallStack& operator=(const SmallStack& other) {
+        if (this != &other) {
+            clear();
+            for (size_t i = 0; i < other.count; i++) {
+                push(other.slots[i]);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Operador de asignación por movimiento.
+     */
+    SmallStack& operator=(SmallStack&& other) noexcept {
+        if (this != &other) {
+            destroy_all();
+            release_heap();
+            slots = reinterpret_cast<T *>(inline_slots);
+            capacity = N;
+            take(other);
+        }
+        return *this;
+    }
+
+    ~SmallStack() {
+        destroy_all();
+        release_heap();
+    }
+
+    /**
+     * @brief Verifica si la pila está vacía.
+     * @return true si la pila está vacía, false en caso contrario.
+     */
+    bool empty() const {
+        return count == 0;
+    }
+
+    /**
+     * @brief Obtiene el número de elementos en la pila.
+     * @return El número de elementos en la pila.
+     */
+    int size() const {
+        return static_cast<int>(count);
+    }
+
+    /**
+     * @brief Indica si los elementos siguen dentro del objeto (nunca se pasó de N elementos).
+     */
+    bool is_inline() const {
+        return !on_heap();
+    }
+
+    /**
+     * @brief Devuelve una referencia al elemento en la cima de la pila.
+     * @return Referencia al último elemento agregado a la pila.
+     * @throws std::out_of_range si la pila está vacía.
+     */
+    T& top() {
+        if (empty()) {
+            throw std::out_of_range("La pila está vacía. No se puede acceder al elemento en top.");
+        }
+        return slots[count - 1];
+    }
+
+    /**
+     * @brief Inserta un nuevo elemento en la cima de la pila.
+     * @param value El valor que se va a insertar en la pila.
+     */
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    /**
+     * @brief Inserta un nuevo elemento movido en la cima de la pila.
+     * @param value El valor que se va a mover a la pila.
+     */
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief Construye un elemento directamente en la cima de la pila.
+     * @param args Argumentos para el constructor de T.
+     * @return Referencia al elemento construido.
+     */
+    template<class... Args>
+    T& emplace(Args&&... args) {
+        if (count == capacity) {
+            // Se construye antes de crecer: los argumentos pueden referirse a un elemento de la propia pila
+            T value(std::forward<Args>(args)...);
+            grow();
+            ::new (slots + count) T(std::move(value));
+        } else {
+            ::new (slots + count) T(std::forward<Args>(args)...);
+        }
+        return slots[count++];
+    }
+
+    /**
+     * @brief Elimina y devuelve el elemento en la cima de la pila. El elemento se mueve, no se copia.
+     * @return T El valor del elemento eliminado de la cima de la pila.
+     * @throws std::out_of_range si la pila está vacía.
+     */
+    T pop() {
+        if (empty()) {
+            throw std::out_of_range("La pila está vacía. No se puede eliminar ningún elemento.");
+        }
+        T value = std::move(slots[count - 1]);
+        slots[--count].~T();
+        return value;
+    }
+
+    /**
+     * @brief Elimina hasta n elementos de la cima y los escribe (movidos) en "out", empezando por la cima.
+     * @param n Número máximo de elementos a eliminar.
+     * @param out Iterador de salida donde se escriben los elementos.
+     * @return El número de elementos eliminados (menor que n si la pila tenía menos).
+     */
+    template<class OutputIt>
+    int pop_n(int n, OutputIt out) {
+        int removed = 0;
+        while (removed < n && count > 0) {
+            *out++ = std::move(slots[count - 1]);
+            slots[--count].~T();
+            removed++;
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Destruye todos los elementos. Si la pila ya usaba memoria dinámica, la conserva.
+     */
+    void clear() {
+        destroy_all();
+    }
+};
+
+#endif // SMALL_STACK_H
@@ -5,6 +5,7 @@
 #include <list>
 #include <stdexcept>
 #include <initializer_list>
+#include <utility>
 
 // Clase Stack que permite elegir el contenedor subyacente
 template<class T, template<typename, typename...> class Container = std::vector>
@@ -104,7 +105,18 @@ public:
     }
 
     /**
-     * @brief Elimina y devuelve el elemento en la cima de la pila.
+     * @brief Construye un elemento directamente en la cima de la pila.
+     * @param args Argumentos para el constructor de T.
+     * @return Referencia al elemento construido.
+     */
+    template<class... Args>
+    T& emplace(Args&&... args) {
+        stackContainer.emplace_back(std::forward<Args>(args)...);
+        return stackContainer.back();
+    }
+
+    /**
+     * @brief Elimina y devuelve el elemento en la cima de la pila. El elemento se mueve, no se copia.
      * @return T El valor del elemento eliminado de la cima de la pila.
      * @throws std::out_of_range si la pila está vacía.
      */
@@ -112,10 +124,27 @@ public:
         if (empty()) {
             throw std::out_of_range("La pila está vacía. No se puede eliminar ningún elemento.");
         }
-        T value = stackContainer.back();
+        T value = std::move(stackContainer.back());
         stackContainer.pop_back();
         return value;
     }
+
+    /**
+     * @brief Elimina hasta n elementos de la cima y los escribe (movidos) en "out", empezando por la cima.
+     * @param n Número máximo de elementos a eliminar.
+     * @param out Iterador de salida donde se escriben los elementos.
+     * @return El número de elementos eliminados (menor que n si la pila tenía menos).
+     */
+    template<class OutputIt>
+    int pop_n(int n, OutputIt out) {
+        int removed = 0;
+        while (removed < n && !stackContainer.empty()) {
+            *out++ = std::move(stackContainer.back());
+            stackContainer.pop_back();
+            removed++;
+        }
+        return removed;
+    }
 };
 
 #endif // STACK_H
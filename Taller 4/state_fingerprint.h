@@ -0,0 +1,201 @@
+#ifndef STATE_FINGERPRINT_H
+#define STATE_FINGERPRINT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+// Huella (fingerprint) de una cola de bits que se actualiza al quitar bits del frente y agregar bits al final, sin
+// recorrer la cola. Se usan dos hashes polinomiales independientes módulo el primo de Mersenne 2^61 - 1: la cola
+// b_0 ... b_{n-1} se resume como sum (b_i + 1) * B^(n-1-i) para cada base B. Junto con la longitud, dos colas
+// distintas de n bits solo coinciden con probabilidad del orden de (n / 2^61)^2.
+class StateFingerprint {
+public:
+    // Clave comparable y hasheable con la huella completa
+    struct Key {
+        uint64_t h0;
+        uint64_t h1;
+        uint64_t length;
+
+        bool operator==(const Key &other) const {
+            return h0 == other.h0 && h1 == other.h1 && length == other.length;
+        }
+        bool operator!=(const Key &other) const {
+            return !(*this == other);
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            // h0 y h1 ya son uniformes; se mezcla la longitud para no depender de un solo hash
+            return static_cast<size_t>(key.h0 ^ ((key.h1 ^ key.length) * 0x9E3779B97F4A7C15ULL));
+        }
+    };
+
+private:
+    static constexpr uint64_t MOD = (uint64_t(1) << 61) - 1;
+
+    static uint64_t mul(uint64_t a, uint64_t b) {
+        __uint128_t product = static_cast<__uint128_t>(a) * b;
+        uint64_t r = static_cast<uint64_t>(product & MOD) + static_cast<uint64_t>(product >> 61);
+        return r >= MOD ? r - MOD : r;
+    }
+
+    static uint64_t add(uint64_t a, uint64_t b) {
+        uint64_t r = a + b;
+        return r >= MOD ? r - MOD : r;
+    }
+
+    static uint64_t sub(uint64_t a, uint64_t b) {
+        return a >= b ? a - b : a + MOD - b;
+    }
+
+    static uint64_t power(uint64_t base, uint64_t exponent) {
+        uint64_t result = 1;
+        while (exponent > 0) {
+            if (exponent & 1) {
+                result = mul(result, base);
+            }
+            base = mul(base, base);
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+    // Tablas precalculadas de una base: potencias e inversas hasta 64 y el valor de cada byte (8 bits de golpe)
+    struct Base {
+        uint64_t pow[65];
+        uint64_t inv_pow[65];
+        uint64_t byte_value[256];
+
+        explicit Base(uint64_t base) {
+            uint64_t inverse = power(base, MOD - 2);
+            pow[0] = inv_pow[0] = 1;
+            for (int k = 1; k <= 64; k++) {
+                pow[k] = mul(pow[k - 1], base);
+                inv_pow[k] = mul(inv_pow[k - 1], inverse);
+            }
+            for (int byte = 0; byte < 256; byte++) {
+                uint64_t value = 0;
+                for (int i = 0; i < 8; i++) {
+                    value = add(mul(value, base), ((byte >> i) & 1) + 1);
+                }
+                byte_value[byte] = value;
+            }
+        }
+
+        /**
+         * @brief Valor polinomial de "count" bits (el bit 0 de "bits" es el primero, el de mayor potencia).
+         */
+        uint64_t value_of(uint64_t bits, int count) const {
+            uint64_t value = 0;
+            int i = 0;
+            for (; i + 8 <= count; i += 8) {
+                value = add(mul(value, pow[8]), byte_value[(bits >> i) & 0xFF]);
+            }
+            for (; i < count; i++) {
+                value = add(mul(value, pow[1]), ((bits >> i) & 1) + 1);
+            }
+            return value;
+        }
+    };
+
+    // Las tablas se construyen una sola vez (la inicialización de estáticos locales es segura entre hilos)
+    static const Base &base(int k) {
+        static const Base bases[2] = {Base(0x1F3D5B79A2C4E6ULL), Base(0x0ABCDEF12345677ULL)};
+        return bases[k];
+    }
+
+    uint64_t hash[2] = {0, 0};
+    uint64_t scale[2] = {1, 1};   // B^length para cada base
+    uint64_t length = 0;
+
+public:
+    /**
+     * @brief Agrega "count" bits (count <= 64) al final; el bit 0 de "bits" es el primero en agregarse.
+     */
+    void append_bits(uint64_t bits, int count) {
+        for (int k = 0; k < 2; k++) {
+            const Base &b = base(k);
+            hash[k] = add(mul(hash[k], b.pow[count]), b.value_of(bits, count));
+            scale[k] = mul(scale[k], b.pow[count]);
+        }
+        length += count;
+    }
+
+    /**
+     * @brief Quita del frente los "count" bits (count <= 64) indicados; el bit 0 de "bits" es el del frente.
+     */
+    void pop_front(uint64_t bits, int count) {
+        for (int k = 0; k < 2; k++) {
+            const Base &b = base(k);
+            scale[k] = mul(scale[k], b.inv_pow[count]);   // B^(length - count): peso del primer bit que sobrevive
+            hash[k] = sub(hash[k], mul(b.value_of(bits, count), scale[k]));
+        }
+        length -= count;
+    }
+
+    /**
+     * @brief Huella actual.
+     */
+    Key key() const {
+        return Key{hash[0], hash[1], length};
+    }
+};
+
+// Conjunto de huellas con direccionamiento abierto (sondeo lineal) en un solo arreglo: insertar no reserva memoria
+// por elemento, así que guardar millones de huellas no fragmenta el heap (como pasaría con un set de nodos)
+class FingerprintSet {
+private:
+    static constexpr uint64_t EMPTY_LENGTH = ~uint64_t(0);   // Ninguna cola tiene esta longitud
+
+    std::vector<StateFingerprint::Key> table;   // Capacidad siempre potencia de dos
+    size_t count = 0;
+
+    void rehash(size_t new_capacity) {
+        std::vector<StateFingerprint::Key> old = std::move(table);
+        table.assign(new_capacity, StateFingerprint::Key{0, 0, EMPTY_LENGTH});
+        size_t mask = new_capacity - 1;
+        for (const StateFingerprint::Key &key : old) {
+            if (key.length != EMPTY_LENGTH) {
+                size_t i = StateFingerprint::KeyHash()(key) & mask;
+                while (table[i].length != EMPTY_LENGTH) {
+                    i = (i + 1) & mask;
+                }
+                table[i] = key;
+            }
+        }
+    }
+
+public:
+    FingerprintSet() : table(64, StateFingerprint::Key{0, 0, EMPTY_LENGTH}) {}
+
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * @brief Inserta una huella.
+     * @return false si la huella ya estaba en el conjunto.
+     */
+    bool insert(const StateFingerprint::Key &key) {
+        // Factor de carga máximo de 1/2 para mantener los sondeos cortos
+        if (2 * (count + 1) > table.size()) {
+            rehash(table.size() * 2);
+        }
+        size_t mask = table.size() - 1;
+        size_t i = StateFingerprint::KeyHash()(key) & mask;
+        while (table[i].length != EMPTY_LENGTH) {
+            if (table[i] == key) {
+                return false;
+            }
+            i = (i + 1) & mask;
+        }
+        table[i] = key;
+        count++;
+        return true;
+    }
+};
+
+#endif // STATE_FINGERPRINT_H
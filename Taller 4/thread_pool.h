@@ -0,0 +1,98 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <stdexcept>
+#include "queue_list.h"
+
+// Grupo fijo de hilos que ejecutan tareas en orden de llegada desde una Queue compartida.
+// Si se indica max_pending, submit espera mientras haya esa cantidad de tareas sin empezar: quien produce tareas
+// (por ejemplo, leyendo un archivo) no puede adelantarse indefinidamente a quienes las ejecutan.
+// Las tareas no deben lanzar excepciones.
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    Queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable task_ready;   // Hay tareas nuevas o el grupo se está deteniendo
+    std::condition_variable task_taken;   // Una tarea empezó o terminó
+    size_t max_pending;
+    int running = 0;
+    bool stopping = false;
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            task_ready.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            std::function<void()> task = tasks.dequeue();
+            running++;
+            task_taken.notify_all();
+            lock.unlock();
+            task();
+            lock.lock();
+            running--;
+            task_taken.notify_all();
+        }
+    }
+
+public:
+    /**
+     * @brief Crea el grupo con "threads" hilos.
+     * @param max_pending Máximo de tareas en espera antes de que submit bloquee (0 = sin límite).
+     * @throws std::invalid_argument si threads < 1.
+     */
+    explicit ThreadPool(int threads, size_t max_pending = 0) : max_pending(max_pending) {
+        if (threads < 1) {
+            throw std::invalid_argument("ThreadPool needs at least one thread");
+        }
+        for (int i = 0; i < threads; i++) {
+            workers.emplace_back([this] { work(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Termina las tareas pendientes y detiene los hilos.
+     */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        task_ready.notify_all();
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Agrega una tarea (espera si ya hay max_pending tareas sin empezar).
+     */
+    void submit(std::function<void()> task) {
+        std::unique_lock<std::mutex> lock(mutex);
+        task_taken.wait(lock, [this] {
+            return max_pending == 0 || static_cast<size_t>(tasks.size()) < max_pending;
+        });
+        tasks.enqueue(std::move(task));
+        task_ready.notify_one();
+    }
+
+    /**
+     * @brief Espera a que todas las tareas agregadas hayan terminado.
+     */
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        task_taken.wait(lock, [this] { return tasks.empty() && running == 0; });
+    }
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,374 @@
+#ifndef WORK_STEALING_H
+#define WORK_STEALING_H
+
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <cstdint>
+#include "queue_list.h"
+#include "concurrent_queue.h"
+
+// Deque de Chase y Lev (con los órdenes de memoria de Lê, Pop, Cohen y Zappa Nardelli, "Correct and Efficient
+// Work-Stealing for Weak Memory Models", 2013). El hilo dueño usa el extremo inferior como una pila (push/pop, LIFO);
+// los demás hilos roban del extremo superior (steal, FIFO). Solo pop y steal compiten, y solo por el último elemento.
+// El arreglo circular crece duplicándose; los arreglos viejos se conservan hasta destruir el deque porque un ladrón
+// puede estar leyendo de ellos.
+// T debe ser trivialmente copiable (normalmente un puntero), porque las casillas se leen y escriben de forma atómica.
+template<class T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque guarda valores trivialmente copiables");
+
+private:
+    struct Array {
+        const int64_t capacity;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit Array(int64_t capacity) : capacity(capacity), slots(new std::atomic<T>[capacity]) {}
+
+        T get(int64_t i) const {
+            return slots[i & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t i, T value) {
+            slots[i & (capacity - 1)].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(concurrent_detail::CACHE_LINE) std::atomic<int64_t> top{0};      // Lo avanzan los ladrones (y pop con el último elemento)
+    alignas(concurrent_detail::CACHE_LINE) std::atomic<int64_t> bottom{0};   // Solo lo escribe el dueño
+    std::atomic<Array *> array;
+    std::vector<std::unique_ptr<Array>> arrays;           // Todos los arreglos usados (solo los toca el dueño)
+
+    Array *grow(Array *old, int64_t b, int64_t t) {
+        arrays.push_back(std::make_unique<Array>(old->capacity * 2));
+        Array *bigger = arrays.back().get();
+        for (int64_t i = t; i < b; i++) {
+            bigger->put(i, old->get(i));
+        }
+        array.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+public:
+    /**
+     * @brief Crea un deque vacío con capacidad inicial "capacity" (se redondea a potencia de dos).
+     */
+    explicit WorkStealingDeque(size_t capacity = 256) {
+        arrays.push_back(std::make_unique<Array>(static_cast<int64_t>(concurrent_detail::round_up_to_power_of_two(capacity))));
+        array.store(arrays.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Agrega un elemento abajo (solo el dueño).
+     */
+    void push(T value) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        Array *a = array.load(std::memory_order_relaxed);
+        if (b - t > a->capacity - 1) {
+            a = grow(a, b, t);
+        }
+        a->put(b, value);
+        // Publica el elemento (y lo que apunta) a los ladrones que lean bottom con acquire
+        bottom.store(b + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Quita el elemento de abajo, el último agregado (solo el dueño).
+     * @return false si el deque estaba vacío o un ladrón se llevó el último elemento.
+     */
+    bool pop(T &out) {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Array *a = array.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        out = a->get(b);
+        if (t == b) {
+            // Último elemento: compite con los ladrones por él
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Roba el elemento de arriba, el más antiguo (cualquier hilo).
+     * @return false si el deque estaba vacío o otro hilo ganó la carrera por ese elemento.
+     */
+    bool steal(T &out) {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        Array *a = array.load(std::memory_order_acquire);
+        T value = a->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false;
+        }
+        out = value;
+        return true;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Número aproximado de elementos.
+     */
+    size_t size() const {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+};
+
+// Grupo de tareas creadas con spawn; sync espera a que terminen todas
+class TaskGroup {
+private:
+    friend class WorkStealingPool;
+    std::atomic<long long> pending{0};
+};
+
+// Estadísticas de un hilo del grupo
+struct WorkerStats {
+    long long executed = 0;   // Tareas ejecutadas
+    long long stolen = 0;     // Tareas robadas a otros hilos
+};
+
+// Grupo de hilos con un WorkStealingDeque por hilo, para trabajo de tipo fork-join:
+//
+//     WorkStealingPool pool(4);
+//     pool.run([&] {
+//         TaskGroup group;
+//         pool.spawn(group, [&] { left = solve(left_half); });
+//         right = solve(right_half);
+//         pool.sync(group);
+//     });
+//
+// spawn desde un hilo del grupo deja la tarea en su propio deque (la más reciente es la primera que retoma). Un hilo
+// sin trabajo roba la tarea más antigua de otro hilo elegido al azar, que en un algoritmo recursivo es la de mayor
+// tamaño. sync no bloquea el hilo: mientras el grupo tenga tareas pendientes, ejecuta otras tareas.
+// Las tareas que se crean desde fuera del grupo (run) entran por una cola compartida.
+// Las tareas no deben lanzar excepciones.
+class WorkStealingPool {
+private:
+    struct Task {
+        std::function<void()> function;
+        TaskGroup *group;
+    };
+
+    struct alignas(concurrent_detail::CACHE_LINE) Worker {
+        WorkStealingDeque<Task *> deque;
+        WorkerStats stats;
+        std::minstd_rand rng;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+
+    std::mutex injection_mutex;
+    Queue<Task *> injection;                     // Tareas creadas fuera del grupo
+    std::atomic<int> injected{0};                // Tamaño de "injection", para no tomar el mutex si está vacía
+    std::condition_variable work_available;
+    std::atomic<int> active_runs{0};             // Llamadas a run en curso; sin ninguna, los hilos duermen
+    bool stopping = false;
+
+    // Índice del hilo actual dentro de este grupo (-1 si no pertenece)
+    int current_index() const {
+        return current_pool() == this ? current_worker() : -1;
+    }
+
+    static const WorkStealingPool *&current_pool() {
+        thread_local const WorkStealingPool *pool = nullptr;
+        return pool;
+    }
+
+    static int &current_worker() {
+        thread_local int index = -1;
+        return index;
+    }
+
+    void execute(Task *task, int index) {
+        task->function();
+        if (index >= 0) {
+            workers[index]->stats.executed++;
+        }
+        // Después de esto, quien espera en sync puede destruir el grupo
+        task->group->pending.fetch_sub(1, std::memory_order_acq_rel);
+        delete task;
+    }
+
+    // Busca una tarea: primero el deque propio, después la cola compartida y después otro hilo al azar
+    Task *find_task(int index) {
+        Task *task = nullptr;
+        if (index >= 0 && workers[index]->deque.pop(task)) {
+            return task;
+        }
+        if (injected.load(std::memory_order_acquire) > 0) {
+            std::lock_guard<std::mutex> lock(injection_mutex);
+            if (injection.try_dequeue(task)) {
+                injected.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+        int count = static_cast<int>(workers.size());
+        if (index >= 0 && count > 1) {
+            Worker &self = *workers[index];
+            int start = static_cast<int>(self.rng() % count);
+            for (int i = 0; i < count; i++) {
+                int victim = (start + i) % count;
+                if (victim != index && workers[victim]->deque.steal(task)) {
+                    self.stats.stolen++;
+                    return task;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    void work(int index) {
+        current_pool() = this;
+        current_worker() = index;
+        int spins = 0;
+        while (true) {
+            Task *task = find_task(index);
+            if (task != nullptr) {
+                execute(task, index);
+                spins = 0;
+                continue;
+            }
+            if (active_runs.load(std::memory_order_acquire) == 0) {
+                std::unique_lock<std::mutex> lock(injection_mutex);
+                work_available.wait(lock, [this] { return stopping || active_runs.load() > 0; });
+                if (stopping) {
+                    return;
+                }
+            } else {
+                concurrent_detail::backoff(spins);
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Crea el grupo con "threads" hilos.
+     * @throws std::invalid_argument si threads < 1.
+     */
+    explicit WorkStealingPool(int threads) {
+        if (threads < 1) {
+            throw std::invalid_argument("WorkStealingPool needs at least one thread");
+        }
+        for (int i = 0; i < threads; i++) {
+            workers.push_back(std::make_unique<Worker>());
+            workers.back()->rng.seed(i + 1);
+        }
+        for (int i = 0; i < threads; i++) {
+            this->threads.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(injection_mutex);
+            stopping = true;
+        }
+        work_available.notify_all();
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+    }
+
+    int size() const {
+        return static_cast<int>(workers.size());
+    }
+
+    /**
+     * @brief Crea una tarea del grupo "group". Desde un hilo del grupo va a su deque; desde fuera, a la cola compartida.
+     */
+    void spawn(TaskGroup &group, std::function<void()> function) {
+        group.pending.fetch_add(1, std::memory_order_relaxed);
+        Task *task = new Task{std::move(function), &group};
+        int index = current_index();
+        if (index >= 0) {
+            workers[index]->deque.push(task);
+        } else {
+            std::lock_guard<std::mutex> lock(injection_mutex);
+            injection.enqueue(task);
+            injected.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Espera a que terminen todas las tareas de "group". Un hilo del grupo ejecuta otras tareas mientras espera.
+     */
+    void sync(TaskGroup &group) {
+        int index = current_index();
+        int spins = 0;
+        while (group.pending.load(std::memory_order_acquire) > 0) {
+            Task *task = index >= 0 ? find_task(index) : nullptr;
+            if (task != nullptr) {
+                execute(task, index);
+                spins = 0;
+            } else {
+                concurrent_detail::backoff(spins);
+            }
+        }
+    }
+
+    /**
+     * @brief Ejecuta "function" en un hilo del grupo y espera a que termine (incluidas las tareas que haya sincronizado).
+     *        Se llama desde fuera del grupo.
+     */
+    void run(std::function<void()> function) {
+        TaskGroup group;
+        active_runs.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(injection_mutex);
+            work_available.notify_all();
+        }
+        spawn(group, std::move(function));
+        sync(group);
+        active_runs.fetch_sub(1);
+    }
+
+    /**
+     * @brief Tareas ejecutadas y robadas por cada hilo (leer cuando no hay un run en curso).
+     */
+    std::vector<WorkerStats> stats() const {
+        std::vector<WorkerStats> result;
+        for (const std::unique_ptr<Worker> &worker : workers) {
+            result.push_back(worker->stats);
+        }
+        return result;
+    }
+
+    void reset_stats() {
+        for (std::unique_ptr<Worker> &worker : workers) {
+            worker->stats = WorkerStats();
+        }
+    }
+};
+
+#endif // WORK_STEALING_H
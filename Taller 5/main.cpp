@@ -4,6 +4,10 @@
 #include <sstream>
 #include <chrono>
 #include <cassert>
+#include <array>
+#include <string_view>
+#include <algorithm>
+#include <iterator>
 
 #include "AVL.h"
 
@@ -20,16 +24,133 @@ struct morseAndCharacter {
 	}
 };
 
-class MorseAVL : public AvlTree<morseAndCharacter> {
+struct morseCodeEntry {
+    char character;
+    std::string_view morseCode;
+};
+
+// Standard Morse code: letters, digits and "/" for the space between words
+constexpr morseCodeEntry standardMorseCode[] = {
+    {'A', ".-"}, {'B', "-..."}, {'C', "-.-."}, {'D', "-.."}, {'E', "."}, {'F', "..-."}, {'G', "--."},
+    {'H', "...."}, {'I', ".."}, {'J', ".---"}, {'K', "-.-"}, {'L', ".-.."}, {'M', "--"}, {'N', "-."},
+    {'O', "---"}, {'P', ".--."}, {'Q', "--.-"}, {'R', ".-."}, {'S', "..."}, {'T', "-"}, {'U', "..-"},
+    {'V', "...-"}, {'W', ".--"}, {'X', "-..-"}, {'Y', "-.--"}, {'Z', "--.."}, {' ', "/"},
+    {'0', "-----"}, {'1', ".----"}, {'2', "..---"}, {'3', "...--"}, {'4', "....-"}, {'5', "....."},
+    {'6', "-...."}, {'7', "--..."}, {'8', "---.."}, {'9', "----."},
+};
+
+constexpr int standardMorseCodeSize = sizeof(standardMorseCode) / sizeof(standardMorseCode[0]);
+
+// Encode table indexed by byte: the code of each standard character (lower case letters included), empty otherwise
+constexpr std::array<std::string_view, 256> makeMorseEncodeTable() {
+    std::array<std::string_view, 256> table{};
+    for (const morseCodeEntry &entry : standardMorseCode) {
+        table[static_cast<unsigned char>(entry.character)] = entry.morseCode;
+        if (entry.character >= 'A' && entry.character <= 'Z') {
+            table[static_cast<unsigned char>(entry.character - 'A' + 'a')] = entry.morseCode;
+        }
+    }
+    return table;
+}
+
+constexpr std::array<std::string_view, 256> morseEncodeTable = makeMorseEncodeTable();
+
+// The tree is inherited as protected: insert, remove and makeEmpty from AvlTree would bypass the decoding trie and
+// the encode counters, so only the read-only queries are exposed and changes go through insertMorse, removeMorse and
+// makeEmpty
+class MorseAVL : protected AvlTree<morseAndCharacter> {
 public:
     MorseAVL() : AvlTree<morseAndCharacter>() {}
 
+    bool contains(const morseAndCharacter &entry) const {
+        return AvlTree<morseAndCharacter>::contains(entry);
+    }
+
+    bool isEmpty() const {
+        return AvlTree<morseAndCharacter>::isEmpty();
+    }
+
+    const morseAndCharacter &findMin() const {
+        return AvlTree<morseAndCharacter>::findMin();
+    }
+
+    const morseAndCharacter &findMax() const {
+        return AvlTree<morseAndCharacter>::findMax();
+    }
+
+    // Insert a character and also index its code in the decoding trie. A character that is already in the tree keeps
+    // its first code, as before
     void insertMorse(char character, const std::string &morseCode) {
-        this->insert(morseAndCharacter{static_cast<char>(toupper(character)), morseCode});
+        morseAndCharacter entry{static_cast<char>(toupper(character)), morseCode};
+        if (this->contains(entry)) {
+            return;
+        }
+        int node = 0;
+        for (char symbol : morseCode) {
+            node = trieChild(node, symbol);
+        }
+        if (node < 0 || morseCode.empty()) {
+            hasUnindexedCodes = true;
+        } else if (decodeTrie[node] == '\0') {
+            decodeTrie[node] = entry.character;
+        }
+        if (morseEncodeTable[static_cast<unsigned char>(entry.character)] == morseCode) {
+            standardCodes++;
+        } else {
+            customCodes++;
+        }
+        this->insert(std::move(entry));
     }
 
-    // Translate a text string to Morse code
-	std::string translateToMorse(const std::string &text) {
+    // Remove a character together with its trie slot and its place in the encode counters. If another character was
+    // inserted with the same code, it takes over the trie slot
+    void removeMorse(char character) {
+        char upper = static_cast<char>(toupper(character));
+        std::string morseCode = findCode(upper);
+        morseAndCharacter entry{upper, morseCode};
+        if (!this->contains(entry)) {
+            return;
+        }
+        this->remove(entry);
+        int node = 0;
+        for (char symbol : morseCode) {
+            node = trieChild(node, symbol);
+        }
+        if (node >= 0 && !morseCode.empty() && decodeTrie[node] == upper) {
+            decodeTrie[node] = findCharacter(morseCode, this->root);
+        }
+        if (morseEncodeTable[static_cast<unsigned char>(upper)] == morseCode) {
+            standardCodes--;
+        } else {
+            customCodes--;
+        }
+    }
+
+    // Remove every character and reset the trie and the counters
+    void makeEmpty() {
+        AvlTree<morseAndCharacter>::makeEmpty();
+        std::fill(std::begin(decodeTrie), std::end(decodeTrie), '\0');
+        hasUnindexedCodes = false;
+        standardCodes = 0;
+        customCodes = 0;
+    }
+
+    // Whether the tree holds exactly the standard code set, so that translateToMorse can use the encode table
+    bool usesEncodeTable() const {
+        return customCodes == 0 && standardCodes == standardMorseCodeSize;
+    }
+
+    // Translate a text string to Morse code. When the tree holds exactly the standard code set, this uses the
+    // constexpr encode table; otherwise it searches the tree for each character
+    std::string translateToMorse(const std::string &text) {
+        if (usesEncodeTable()) {
+            return translateWithTable(text);
+        }
+        return translateToMorseWithTree(text);
+    }
+
+    // Translate a text string to Morse code searching the tree for each character (works for any alphabet)
+	std::string translateToMorseWithTree(const std::string &text) {
         std::string morseTranslation;
         for (char ch : text) {
             std::string morse = findCode(toupper(ch));
@@ -41,38 +162,35 @@ public:
 				morseTranslation += "?";
 			}
         }
-		if (morseTranslation.back() == ' ') morseTranslation.pop_back();
+		if (!morseTranslation.empty() && morseTranslation.back() == ' ') morseTranslation.pop_back();
         return morseTranslation;
     }
 
-    // Translate Morse code back to text
+    // Translate Morse code back to text. Each code is resolved while it is read, walking the decoding trie one
+    // symbol at a time, so there is no per-code string and no tree search
     std::string translateToText(const std::string &morse) {
         std::string textTranslation;
-        std::string code;
-        for (size_t i = 0; i < morse.length(); ++i) {
-            if (morse[i] != ' ' && morse[i] != '/') {
-                code += morse[i];
-            } else {
-                if (morse[i] == '/') { // Nuevo espacio entre palabras
-                    textTranslation += ' ';
-                } else if (!code.empty()) { // Fin de un carácter en Morse
-                    char character = findCharacter(code, this->root);
-                    if (character) {
-                        textTranslation += character;
-                    } else {
-						textTranslation += '?';
-					}
-                    code.clear();
+        textTranslation.reserve(morse.length() / 3);
+        size_t codeStart = 0;
+        int node = 0; // Trie node of the code read so far, or -1 if it cannot be in the trie
+        for (size_t i = 0; i <= morse.length(); ++i) {
+            char symbol = i < morse.length() ? morse[i] : ' ';
+            if (symbol != ' ' && symbol != '/') {
+                node = trieChild(node, symbol);
+                continue;
+            }
+            if (i > codeStart) { // Fin de un carácter en Morse
+                char character = node >= 0 ? decodeTrie[node] : '\0';
+                if (node < 0 && hasUnindexedCodes) {
+                    character = findCharacter(morse.substr(codeStart, i - codeStart), this->root);
                 }
+                textTranslation += character ? character : '?';
             }
-        }
-        if (!code.empty()) { // Traducción del último código si no está seguido de espacio
-            char character = findCharacter(code, this->root);
-            if (character) {
-                textTranslation += character;
-            } else {
-				textTranslation += '?';
-			}
+            if (symbol == '/') { // Nuevo espacio entre palabras
+                textTranslation += ' ';
+            }
+            codeStart = i + 1;
+            node = 0;
         }
         return textTranslation;
     }
@@ -83,7 +201,56 @@ public:
     }
 
 private:
-    
+    // Decoding trie stored as a flat array: node 0 is the empty code and the children of node i are 2i + 1 (dot) and
+    // 2i + 2 (dash). Each slot holds the character whose code ends there, or '\0'. It covers codes of up to
+    // MAX_TRIE_DEPTH symbols (letters and digits use at most five, punctuation up to seven); other codes, such as
+    // "/", are only found by the tree search in findCharacter
+    static const int MAX_TRIE_DEPTH = 7;
+    static const int TRIE_SIZE = (1 << (MAX_TRIE_DEPTH + 1)) - 1;
+    char decodeTrie[TRIE_SIZE] = {};
+    bool hasUnindexedCodes = false; // Only enables the fallback search, so removeMorse leaves it set
+
+    // Number of characters in the tree whose code matches morseEncodeTable, and number with any other code. They are
+    // counts rather than flags so that removeMorse can bring the tree back to the standard set
+    int standardCodes = 0;
+    int customCodes = 0;
+
+    // Same output as translateToMorseWithTree, in two passes over the text: the first one adds up the exact length
+    // (code + ' ' for known characters, '?' for the rest) and the second copies the codes into the string
+    static std::string translateWithTable(const std::string &text) {
+        size_t length = 0;
+        for (char ch : text) {
+            std::string_view code = morseEncodeTable[static_cast<unsigned char>(ch)];
+            length += code.empty() ? 1 : code.size() + 1;
+        }
+
+        std::string morseTranslation(length, ' ');
+        char *out = &morseTranslation[0];
+        for (char ch : text) {
+            std::string_view code = morseEncodeTable[static_cast<unsigned char>(ch)];
+            if (code.empty()) {
+                *out++ = '?';
+            } else {
+                for (char symbol : code) {
+                    *out++ = symbol;
+                }
+                out++; // The space after the code is already there
+            }
+        }
+        if (length > 0 && morseTranslation.back() == ' ') {
+            morseTranslation.pop_back();
+        }
+        return morseTranslation;
+    }
+
+    static int trieChild(int node, char symbol) {
+        if (node < 0 || (symbol != '.' && symbol != '-')) {
+            return -1;
+        }
+        int child = 2 * node + (symbol == '.' ? 1 : 2);
+        return child < TRIE_SIZE ? child : -1;
+    }
+
 	char findCharacter(const std::string &code, AvlTree::AvlNode* t) {
         if (t == nullptr) return '\0';
         if (code == t->element.morseCode) return t->element.character;
@@ -282,12 +449,118 @@ void runTests() {
     std::cout << "Tests completed in " << translateToTextDuration.count() << " ms." << std::endl;
 	std::cout << std::endl;
 
+    // Tests for removeMorse and makeEmpty, on a separate tree so that the one printed below stays complete
+    std::cout << "Testing removal..." << std::endl;
+    MorseAVL editTree;
+    for (const morseCodeEntry &entry : standardMorseCode) {
+        editTree.insertMorse(entry.character, std::string(entry.morseCode));
+    }
+
+    // A custom code switches translateToMorse to the tree search, and removing it brings back the encode table
+    assert(editTree.usesEncodeTable() && "Test 9 Failed: Expected the encode table for the standard set");
+    editTree.insertMorse('+', ".-.-.");
+    assert(!editTree.usesEncodeTable() && "Test 10 Failed: Expected the tree search with a custom code");
+    assert(editTree.translateToMorse("A+") == ".- .-.-." && "Test 11 Failed: Expected the custom code for '+'");
+    editTree.removeMorse('+');
+    assert(editTree.usesEncodeTable() && "Test 12 Failed: Expected the encode table after removing the custom code");
+    assert(editTree.translateToMorse("A+") == ".- ?" && "Test 13 Failed: Expected '?' for a removed custom code");
+
+    editTree.removeMorse('E');
+    assert(editTree.translateToText(". -") == "?T" && "Test 14 Failed: Expected '?' for a removed character");
+
+    // Two characters with the same code: the trie keeps the first one until it is removed
+    editTree.insertMorse('+', ".-.-.");
+    editTree.insertMorse('&', ".-.-.");
+    assert(editTree.translateToText(".-.-.") == "+" && "Test 15 Failed: Expected the first character of a code");
+    editTree.removeMorse('+');
+    assert(editTree.translateToText(".-.-.") == "&" && "Test 16 Failed: Expected '&' to take over the code");
+    editTree.removeMorse('&');
+    assert(editTree.translateToText(".-.-.") == "?" && "Test 17 Failed: Expected '?' once both are removed");
+
+    // Codes longer than MAX_TRIE_DEPTH are not in the trie and are found by the tree search
+    editTree.insertMorse('#', "........");
+    assert(editTree.translateToText("........ .-") == "#A" && "Test 18 Failed: Expected '#' for a long code");
+    assert(editTree.translateToText(".........") == "?" && "Test 19 Failed: Expected '?' for an unknown long code");
+    editTree.removeMorse('#');
+    assert(editTree.translateToText("........") == "?" && "Test 20 Failed: Expected '?' for a removed long code");
+
+    editTree.makeEmpty();
+    assert(editTree.isEmpty() && "Test 21 Failed: Expected an empty tree after makeEmpty");
+    assert(editTree.translateToText(".- -...") == "??" && "Test 22 Failed: Expected '??' on an empty tree");
+    editTree.insertMorse('E', ".");
+    editTree.insertMorse('A', ".-");
+    assert(editTree.translateToText(". .- -...") == "EA?" && "Test 23 Failed: Expected 'EA?' after re-inserting");
+    assert(editTree.translateToMorse("EAB") == ". .- ?" && "Test 24 Failed: Expected '. .- ?' after re-inserting");
+	std::cout << std::endl;
+
 	std::cout << "All tests passed!" << std::endl;
 
 	morseTree.print();
 }
 
-int main() {
+// Measure decoding throughput (MB of Morse input per second) on a generated text of letters, digits and spaces
+void runBenchmarks() {
+    MorseAVL morseTree;
+    for (const morseCodeEntry &entry : standardMorseCode) {
+        morseTree.insertMorse(entry.character, std::string(entry.morseCode));
+    }
+
+    // Words of 1 to 8 symbols taken from the alphabet (without the space)
+    const int textLength = 1 << 20;
+    std::string text;
+    unsigned int seed = 12345;
+    while (static_cast<int>(text.size()) < textLength) {
+        seed = seed * 1103515245u + 12345u;
+        int wordLength = 1 + (seed >> 16) % 8;
+        for (int i = 0; i < wordLength; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            char character = standardMorseCode[(seed >> 16) % standardMorseCodeSize].character;
+            text += character == ' ' ? 'E' : character;
+        }
+        text += ' ';
+    }
+    text.pop_back();
+
+    const int repetitions = 20;
+    auto throughput = [&](auto translate, size_t inputSize, std::string &result) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < repetitions; ++r) {
+            result = translate();
+        }
+        std::chrono::duration<double> seconds = std::chrono::high_resolution_clock::now() - start;
+        return repetitions * inputSize / 1e6 / seconds.count();
+    };
+
+    std::string morse, treeMorse, decoded;
+    double tableSpeed = throughput([&] { return morseTree.translateToMorse(text); }, text.size(), morse);
+    double treeSpeed = throughput([&] { return morseTree.translateToMorseWithTree(text); }, text.size(), treeMorse);
+    double decodeSpeed = throughput([&] { return morseTree.translateToText(morse); }, morse.size(), decoded);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Benchmark: " << text.size() / 1e6 << " MB of text, " << morse.size() / 1e6 << " MB of Morse"
+              << std::endl;
+    std::cout << "translateToMorse (encode table): " << tableSpeed << " MB/s"
+              << (morse == treeMorse ? "" : " (WRONG RESULT)") << std::endl;
+    std::cout << "translateToMorse (AVL tree): " << treeSpeed << " MB/s" << std::endl;
+    std::cout << "translateToText: " << decodeSpeed << " MB/s" << (decoded == text ? "" : " (WRONG RESULT)")
+              << std::endl;
+}
+
+// Usage: ./main [--bench]
+// Runs the tests; with --bench it also measures the translation throughput
+int main(int argc, char* argv[]) {
+    bool bench = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--bench") {
+            bench = true;
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+            return 1;
+        }
+    }
     runTests();
+    if (bench) {
+        runBenchmarks();
+    }
     return 0;
 }